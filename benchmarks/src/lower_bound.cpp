@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "utility.hpp"
+
+enum class AlgType { LowerBound, UpperBound, EqualRange, RngLowerBound };
+
+template <class T, AlgType Alg>
+void bm_lower_bound(benchmark::State& state) {
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+
+    std::vector<T> v;
+    if constexpr (std::is_integral_v<T>) {
+        v = random_vector<T>(size);
+    } else if constexpr (std::is_floating_point_v<T>) {
+        v.resize(size);
+        std::mt19937 gen;
+        std::normal_distribution<T> dis(0, 100000.0);
+        std::generate_n(v.begin(), size, [&dis, &gen] { return dis(gen); });
+    } else {
+        static_assert(false);
+    }
+
+    std::sort(v.begin(), v.end());
+
+    // Look up keys in a random order, so that the searches are not helped by the cache more than in real use
+    constexpr std::size_t key_count = 1024;
+    std::vector<T> keys(key_count);
+    std::mt19937_64 key_gen;
+    std::uniform_int_distribution<std::size_t> key_dis(0, size - 1);
+    std::generate(keys.begin(), keys.end(), [&] { return v[key_dis(key_gen)]; });
+
+    for (auto _ : state) {
+        for (const auto& key : keys) {
+            if constexpr (Alg == AlgType::LowerBound) {
+                benchmark::DoNotOptimize(std::lower_bound(v.begin(), v.end(), key));
+            } else if constexpr (Alg == AlgType::UpperBound) {
+                benchmark::DoNotOptimize(std::upper_bound(v.begin(), v.end(), key));
+            } else if constexpr (Alg == AlgType::EqualRange) {
+                benchmark::DoNotOptimize(std::equal_range(v.begin(), v.end(), key));
+            } else {
+                benchmark::DoNotOptimize(std::ranges::lower_bound(v, key));
+            }
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * key_count));
+}
+
+void common_args(auto bm) {
+    bm->Arg(100)->Arg(3000)->Arg(100'000)->Arg(10'000'000);
+}
+
+BENCHMARK(bm_lower_bound<std::uint8_t, AlgType::LowerBound>)->Apply(common_args);
+BENCHMARK(bm_lower_bound<std::int16_t, AlgType::LowerBound>)->Apply(common_args);
+BENCHMARK(bm_lower_bound<std::int32_t, AlgType::LowerBound>)->Apply(common_args);
+BENCHMARK(bm_lower_bound<std::int32_t, AlgType::UpperBound>)->Apply(common_args);
+BENCHMARK(bm_lower_bound<std::int32_t, AlgType::EqualRange>)->Apply(common_args);
+BENCHMARK(bm_lower_bound<std::int32_t, AlgType::RngLowerBound>)->Apply(common_args);
+BENCHMARK(bm_lower_bound<std::uint32_t, AlgType::LowerBound>)->Apply(common_args);
+BENCHMARK(bm_lower_bound<std::int64_t, AlgType::LowerBound>)->Apply(common_args);
+BENCHMARK(bm_lower_bound<std::uint64_t, AlgType::LowerBound>)->Apply(common_args);
+
+BENCHMARK(bm_lower_bound<float, AlgType::LowerBound>)->Apply(common_args);
+BENCHMARK(bm_lower_bound<double, AlgType::LowerBound>)->Apply(common_args);
+BENCHMARK(bm_lower_bound<double, AlgType::UpperBound>)->Apply(common_args);
+
+BENCHMARK_MAIN();
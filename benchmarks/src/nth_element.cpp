@@ -132,6 +132,43 @@ void bm_uniform(benchmark::State& state) {
 BENCHMARK(bm_uniform<alg_type::std_fn>)->Arg(1024)->Arg(2048)->Arg(4096)->Arg(8192);
 BENCHMARK(bm_uniform<alg_type::rng>)->Arg(1024)->Arg(2048)->Arg(4096)->Arg(8192);
 
+enum class pattern { sorted, reversed, organ_pipe, sawtooth, few_unique };
+
+template <alg_type Type, pattern Pattern>
+void bm_pattern(benchmark::State& state) {
+    const int n = static_cast<int>(state.range());
+    vector<int> src(static_cast<size_t>(n));
+    for (int i = 0; i != n; ++i) {
+        switch (Pattern) {
+        case pattern::sorted:
+            src[static_cast<size_t>(i)] = i;
+            break;
+        case pattern::reversed:
+            src[static_cast<size_t>(i)] = n - i;
+            break;
+        case pattern::organ_pipe:
+            src[static_cast<size_t>(i)] = i < n / 2 ? i : n - i;
+            break;
+        case pattern::sawtooth:
+            src[static_cast<size_t>(i)] = i % 1000;
+            break;
+        case pattern::few_unique:
+            src[static_cast<size_t>(i)] = (i * 7919) % 5;
+            break;
+        }
+    }
+
+    benchmark_common<Type>(state, src);
+}
+
+BENCHMARK(bm_pattern<alg_type::std_fn, pattern::sorted>)->Arg(8192)->Arg(1 << 20);
+BENCHMARK(bm_pattern<alg_type::rng, pattern::sorted>)->Arg(8192)->Arg(1 << 20);
+BENCHMARK(bm_pattern<alg_type::std_fn, pattern::reversed>)->Arg(8192)->Arg(1 << 20);
+BENCHMARK(bm_pattern<alg_type::std_fn, pattern::organ_pipe>)->Arg(8192)->Arg(1 << 20);
+BENCHMARK(bm_pattern<alg_type::rng, pattern::organ_pipe>)->Arg(8192)->Arg(1 << 20);
+BENCHMARK(bm_pattern<alg_type::std_fn, pattern::sawtooth>)->Arg(8192)->Arg(1 << 20);
+BENCHMARK(bm_pattern<alg_type::std_fn, pattern::few_unique>)->Arg(8192)->Arg(1 << 20);
+
 BENCHMARK_CAPTURE(benchmark_common<alg_type::std_fn>, adversary1, tukey_ninther_adversary1);
 BENCHMARK_CAPTURE(benchmark_common<alg_type::rng>, adversary1, tukey_ninther_adversary1);
 BENCHMARK_CAPTURE(benchmark_common<alg_type::std_fn>, adversary2, tukey_ninther_adversary2);
@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+enum class Alg {
+    ForEach,
+    Transform,
+    TransformReduce,
+};
+
+enum class Cost {
+    Uniform, // every element costs the same
+    Scattered, // 1% of the elements, picked at random, are 10000 times as expensive as the rest
+    Clustered, // ditto, but the expensive elements are adjacent, at the end of the range
+};
+
+struct element {
+    uint32_t cost;
+    uint32_t result;
+};
+
+uint32_t busy_work(const uint32_t cost, uint32_t x) {
+    // xorshift, so the loop can't be folded into a closed form
+    for (uint32_t i = 0; i < cost; ++i) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+    }
+
+    return x;
+}
+
+vector<element> make_elements(const size_t size, const Cost distribution) {
+    // the skewed distributions cost about as much in total as Uniform
+    constexpr uint32_t uniform_cost = 100;
+    constexpr uint32_t cheap_cost   = 1;
+    constexpr uint32_t heavy_cost   = 10000;
+
+    vector<element> result(size);
+    const size_t heavy_count = size / 100;
+    switch (distribution) {
+    case Cost::Uniform:
+        for (auto& e : result) {
+            e.cost = uniform_cost;
+        }
+        break;
+    case Cost::Scattered:
+    case Cost::Clustered:
+        for (size_t i = 0; i < size; ++i) {
+            result[i].cost = i < size - heavy_count ? cheap_cost : heavy_cost;
+        }
+
+        if (distribution == Cost::Scattered) {
+            mt19937 gen(96337);
+            shuffle(result.begin(), result.end(), gen);
+        }
+        break;
+    }
+
+    for (size_t i = 0; i < size; ++i) {
+        result[i].result = static_cast<uint32_t>(i) | 1;
+    }
+
+    return result;
+}
+
+template <Alg Algorithm, Cost Distribution>
+void bm(benchmark::State& state) {
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    auto elements = make_elements(size, Distribution);
+    vector<uint32_t> out(size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(elements);
+        if constexpr (Algorithm == Alg::ForEach) {
+            for_each(execution::par, elements.begin(), elements.end(),
+                [](element& e) { e.result = busy_work(e.cost, e.result); });
+        } else if constexpr (Algorithm == Alg::Transform) {
+            transform(execution::par, elements.begin(), elements.end(), out.begin(),
+                [](const element& e) { return busy_work(e.cost, e.result); });
+        } else if constexpr (Algorithm == Alg::TransformReduce) {
+            benchmark::DoNotOptimize(transform_reduce(execution::par, elements.begin(), elements.end(), uint32_t{0},
+                bit_xor<>{}, [](const element& e) { return busy_work(e.cost, e.result); }));
+        }
+        benchmark::DoNotOptimize(out);
+    }
+}
+
+void common_args(auto bm) {
+    bm->Arg(1 << 12)->Arg(1 << 16)->UseRealTime();
+}
+
+BENCHMARK(bm<Alg::ForEach, Cost::Uniform>)->Apply(common_args);
+BENCHMARK(bm<Alg::ForEach, Cost::Scattered>)->Apply(common_args);
+BENCHMARK(bm<Alg::ForEach, Cost::Clustered>)->Apply(common_args);
+
+BENCHMARK(bm<Alg::Transform, Cost::Uniform>)->Apply(common_args);
+BENCHMARK(bm<Alg::Transform, Cost::Scattered>)->Apply(common_args);
+BENCHMARK(bm<Alg::Transform, Cost::Clustered>)->Apply(common_args);
+
+BENCHMARK(bm<Alg::TransformReduce, Cost::Uniform>)->Apply(common_args);
+BENCHMARK(bm<Alg::TransformReduce, Cost::Scattered>)->Apply(common_args);
+BENCHMARK(bm<Alg::TransformReduce, Cost::Clustered>)->Apply(common_args);
+
+BENCHMARK_MAIN();
@@ -56,6 +56,28 @@ void BM_push_range(benchmark::State& state) {
     }
 }
 
+template <class T, const auto& Data>
+void BM_make_heap(benchmark::State& state) {
+    vector<T> vec;
+
+    for (auto _ : state) {
+        vec.assign(Data.begin(), Data.end());
+        make_heap(vec.begin(), vec.end());
+        benchmark::DoNotOptimize(vec);
+    }
+}
+
+template <class T, const auto& Data>
+void BM_is_heap(benchmark::State& state) {
+    vector<T> vec(Data.begin(), Data.end());
+    make_heap(vec.begin(), vec.end());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(vec);
+        benchmark::DoNotOptimize(is_heap(vec.begin(), vec.end()));
+    }
+}
+
 void common_args(auto bm) {
     bm->RangeMultiplier(100)->Range(1, vec_size)->Arg(vec_size / 2 + 1);
 }
@@ -72,4 +94,18 @@ BENCHMARK(BM_push_range<string, vec_str>)->Apply(common_args);
 BENCHMARK(BM_push_range<wstring_view, vec_wstr>)->Apply(common_args);
 BENCHMARK(BM_push_range<wstring, vec_wstr>)->Apply(common_args);
 
+BENCHMARK(BM_make_heap<uint8_t, vec_u8>);
+BENCHMARK(BM_make_heap<uint16_t, vec_u16>);
+BENCHMARK(BM_make_heap<uint32_t, vec_u32>);
+BENCHMARK(BM_make_heap<uint64_t, vec_u64>);
+BENCHMARK(BM_make_heap<float, vec_float>);
+BENCHMARK(BM_make_heap<double, vec_double>);
+
+BENCHMARK(BM_is_heap<uint8_t, vec_u8>);
+BENCHMARK(BM_is_heap<uint16_t, vec_u16>);
+BENCHMARK(BM_is_heap<uint32_t, vec_u32>);
+BENCHMARK(BM_is_heap<uint64_t, vec_u64>);
+BENCHMARK(BM_is_heap<float, vec_float>);
+BENCHMARK(BM_is_heap<double, vec_double>);
+
 BENCHMARK_MAIN();
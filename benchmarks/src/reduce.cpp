@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "skewed_allocator.hpp"
+
+using namespace std;
+
+enum class Alg {
+    Reduce,
+    Dot,
+};
+
+template <class T>
+vector<T, not_highly_aligned_allocator<T>> random_vector(const size_t size, mt19937& gen) {
+    vector<T, not_highly_aligned_allocator<T>> result(size);
+
+    if constexpr (is_floating_point_v<T>) {
+        uniform_real_distribution<T> dis(-1.0, 1.0);
+        ranges::generate(result, [&] { return dis(gen); });
+    } else {
+        uniform_int_distribution<T> dis;
+        ranges::generate(result, [&] { return dis(gen); });
+    }
+
+    return result;
+}
+
+template <class T, Alg Algorithm>
+void bm(benchmark::State& state) {
+    mt19937 gen(96337);
+
+    const size_t size = static_cast<size_t>(state.range(0));
+
+    const auto a = random_vector<T>(size, gen);
+    const auto b = random_vector<T>(size, gen);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        if constexpr (Algorithm == Alg::Reduce) {
+            benchmark::DoNotOptimize(reduce(execution::unseq, a.begin(), a.end(), T{0}));
+        } else if constexpr (Algorithm == Alg::Dot) {
+            benchmark::DoNotOptimize(transform_reduce(execution::unseq, a.begin(), a.end(), b.begin(), T{0}));
+        }
+    }
+}
+
+void common_args(auto bm) {
+    bm->Arg(7)->Arg(96)->Arg(1000)->Arg(4093);
+}
+
+BENCHMARK(bm<uint32_t, Alg::Reduce>)->Apply(common_args);
+BENCHMARK(bm<uint64_t, Alg::Reduce>)->Apply(common_args);
+BENCHMARK(bm<float, Alg::Reduce>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::Reduce>)->Apply(common_args);
+
+BENCHMARK(bm<float, Alg::Dot>)->Apply(common_args);
+BENCHMARK(bm<double, Alg::Dot>)->Apply(common_args);
+
+BENCHMARK_MAIN();
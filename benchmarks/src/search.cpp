@@ -120,6 +120,24 @@ void search_default_searcher(benchmark::State& state) {
     }
 }
 
+template <class T, template <class...> class Searcher>
+void search_prebuilt_searcher(benchmark::State& state) {
+    const auto& src_haystack = patterns[static_cast<size_t>(state.range())].data;
+    const auto& src_needle   = patterns[static_cast<size_t>(state.range())].pattern;
+
+    std::vector<T, not_highly_aligned_allocator<T>> haystack(src_haystack.begin(), src_haystack.end());
+    std::vector<T, not_highly_aligned_allocator<T>> needle(src_needle.begin(), src_needle.end());
+
+    // The searcher is built once and reused for every search, as when looking for a fixed pattern in many lines
+    const Searcher<typename decltype(needle)::const_iterator> searcher{needle.cbegin(), needle.cend()};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(haystack);
+        auto res = std::search(haystack.begin(), haystack.end(), searcher);
+        benchmark::DoNotOptimize(res);
+    }
+}
+
 template <class T>
 void member_find(benchmark::State& state) {
     const auto& src_haystack = patterns[static_cast<size_t>(state.range())].data;
@@ -205,6 +223,12 @@ BENCHMARK(search_default_searcher<std::uint16_t>)->Apply(common_args);
 BENCHMARK(search_default_searcher<std::uint32_t>)->Apply(common_args);
 BENCHMARK(search_default_searcher<std::uint64_t>)->Apply(common_args);
 
+BENCHMARK(search_prebuilt_searcher<std::uint8_t, std::default_searcher>)->Apply(common_args);
+BENCHMARK(search_prebuilt_searcher<std::uint8_t, std::boyer_moore_searcher>)->Apply(common_args);
+BENCHMARK(search_prebuilt_searcher<std::uint8_t, std::boyer_moore_horspool_searcher>)->Apply(common_args);
+BENCHMARK(search_prebuilt_searcher<std::uint16_t, std::boyer_moore_searcher>)->Apply(common_args);
+BENCHMARK(search_prebuilt_searcher<std::uint16_t, std::boyer_moore_horspool_searcher>)->Apply(common_args);
+
 BENCHMARK(member_find<not_highly_aligned_string>)->Apply(common_args);
 BENCHMARK(member_find<not_highly_aligned_wstring>)->Apply(common_args);
 BENCHMARK(member_find<not_highly_aligned_u32string>)->Apply(common_args);
@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include "skewed_allocator.hpp"
+#include "utility.hpp"
+
+using namespace std;
+
+enum class alg_type { std_fn, rng };
+
+enum class set_op { merge, set_union, set_intersection, set_difference };
+
+template <class T, set_op Op, alg_type Alg>
+void bm_set_operation(benchmark::State& state) {
+    const auto size            = static_cast<size_t>(state.range(0));
+    const auto overlap_percent = static_cast<uint32_t>(state.range(1));
+
+    // Distribute sorted values between the two inputs, putting the given percentage of them in both
+    auto values = random_vector<T, not_highly_aligned_allocator>(size * 2);
+    ranges::sort(values);
+
+    vector<T, not_highly_aligned_allocator<T>> left;
+    vector<T, not_highly_aligned_allocator<T>> right;
+    left.reserve(size * 2);
+    right.reserve(size * 2);
+
+    mt19937 gen{};
+    uniform_int_distribution<uint32_t> dis(0, 99);
+    for (const auto& v : values) {
+        if (dis(gen) < overlap_percent) {
+            left.push_back(v);
+            right.push_back(v);
+        } else if (gen() & 1) {
+            left.push_back(v);
+        } else {
+            right.push_back(v);
+        }
+    }
+
+    vector<T, not_highly_aligned_allocator<T>> dest(left.size() + right.size());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(left);
+        benchmark::DoNotOptimize(right);
+        if constexpr (Alg == alg_type::rng) {
+            if constexpr (Op == set_op::merge) {
+                benchmark::DoNotOptimize(ranges::merge(left, right, dest.begin()));
+            } else if constexpr (Op == set_op::set_union) {
+                benchmark::DoNotOptimize(ranges::set_union(left, right, dest.begin()));
+            } else if constexpr (Op == set_op::set_intersection) {
+                benchmark::DoNotOptimize(ranges::set_intersection(left, right, dest.begin()));
+            } else {
+                benchmark::DoNotOptimize(ranges::set_difference(left, right, dest.begin()));
+            }
+        } else {
+            if constexpr (Op == set_op::merge) {
+                benchmark::DoNotOptimize(merge(left.begin(), left.end(), right.begin(), right.end(), dest.begin()));
+            } else if constexpr (Op == set_op::set_union) {
+                benchmark::DoNotOptimize(set_union(left.begin(), left.end(), right.begin(), right.end(), dest.begin()));
+            } else if constexpr (Op == set_op::set_intersection) {
+                benchmark::DoNotOptimize(
+                    set_intersection(left.begin(), left.end(), right.begin(), right.end(), dest.begin()));
+            } else {
+                benchmark::DoNotOptimize(
+                    set_difference(left.begin(), left.end(), right.begin(), right.end(), dest.begin()));
+            }
+        }
+        benchmark::DoNotOptimize(dest);
+    }
+}
+
+void common_args(auto bm) {
+    for (const auto& size : {64, 1024, 65536}) {
+        for (const auto& overlap_percent : {0, 10, 50, 90}) {
+            bm->Args({size, overlap_percent});
+        }
+    }
+}
+
+BENCHMARK(bm_set_operation<uint32_t, set_op::merge, alg_type::std_fn>)->Apply(common_args);
+BENCHMARK(bm_set_operation<uint64_t, set_op::merge, alg_type::std_fn>)->Apply(common_args);
+BENCHMARK(bm_set_operation<uint32_t, set_op::merge, alg_type::rng>)->Apply(common_args);
+BENCHMARK(bm_set_operation<uint64_t, set_op::merge, alg_type::rng>)->Apply(common_args);
+
+BENCHMARK(bm_set_operation<uint32_t, set_op::set_union, alg_type::std_fn>)->Apply(common_args);
+BENCHMARK(bm_set_operation<uint64_t, set_op::set_union, alg_type::std_fn>)->Apply(common_args);
+BENCHMARK(bm_set_operation<uint32_t, set_op::set_union, alg_type::rng>)->Apply(common_args);
+BENCHMARK(bm_set_operation<uint64_t, set_op::set_union, alg_type::rng>)->Apply(common_args);
+
+BENCHMARK(bm_set_operation<uint32_t, set_op::set_intersection, alg_type::std_fn>)->Apply(common_args);
+BENCHMARK(bm_set_operation<uint64_t, set_op::set_intersection, alg_type::std_fn>)->Apply(common_args);
+BENCHMARK(bm_set_operation<uint32_t, set_op::set_intersection, alg_type::rng>)->Apply(common_args);
+BENCHMARK(bm_set_operation<uint64_t, set_op::set_intersection, alg_type::rng>)->Apply(common_args);
+
+BENCHMARK(bm_set_operation<uint32_t, set_op::set_difference, alg_type::std_fn>)->Apply(common_args);
+BENCHMARK(bm_set_operation<uint64_t, set_op::set_difference, alg_type::std_fn>)->Apply(common_args);
+BENCHMARK(bm_set_operation<uint32_t, set_op::set_difference, alg_type::rng>)->Apply(common_args);
+BENCHMARK(bm_set_operation<uint64_t, set_op::set_difference, alg_type::rng>)->Apply(common_args);
+
+BENCHMARK(bm_set_operation<int32_t, set_op::set_intersection, alg_type::std_fn>)->Apply(common_args);
+BENCHMARK(bm_set_operation<int64_t, set_op::set_intersection, alg_type::std_fn>)->Apply(common_args);
+
+BENCHMARK_MAIN();
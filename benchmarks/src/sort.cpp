@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <functional>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "utility.hpp"
+
+enum class AlgType { Std, Rng, StdStable, StdPar };
+
+template <class T, AlgType Alg, class Pred = std::less<>>
+void bm_sort(benchmark::State& state) {
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+
+    std::vector<T> src;
+    if constexpr (std::is_integral_v<T>) {
+        src = random_vector<T>(size);
+    } else if constexpr (std::is_floating_point_v<T>) {
+        src.resize(size);
+        std::mt19937 gen;
+        std::normal_distribution<T> dis(0, 100000.0);
+        std::generate_n(src.begin(), size, [&dis, &gen] { return dis(gen); });
+    } else {
+        static_assert(false);
+    }
+
+    std::vector<T> v(size);
+
+    for (auto _ : state) {
+        v = src;
+        benchmark::DoNotOptimize(v);
+        if constexpr (Alg == AlgType::Std) {
+            std::sort(v.begin(), v.end(), Pred{});
+        } else if constexpr (Alg == AlgType::StdStable) {
+            std::stable_sort(v.begin(), v.end(), Pred{});
+        } else if constexpr (Alg == AlgType::StdPar) {
+            std::sort(std::execution::par, v.begin(), v.end(), Pred{});
+        } else {
+            std::ranges::sort(v, Pred{});
+        }
+        benchmark::DoNotOptimize(v);
+    }
+}
+
+void common_args(auto bm) {
+    bm->Arg(100)->Arg(3000)->Arg(1'000'000);
+}
+
+BENCHMARK(bm_sort<std::int8_t, AlgType::Std>)->Apply(common_args);
+BENCHMARK(bm_sort<std::int8_t, AlgType::StdStable>)->Apply(common_args);
+BENCHMARK(bm_sort<std::int16_t, AlgType::Std>)->Apply(common_args);
+BENCHMARK(bm_sort<std::int16_t, AlgType::StdStable>)->Apply(common_args);
+BENCHMARK(bm_sort<std::int32_t, AlgType::Std>)->Apply(common_args);
+BENCHMARK(bm_sort<std::int32_t, AlgType::Rng>)->Apply(common_args);
+BENCHMARK(bm_sort<std::int32_t, AlgType::Std, std::greater<>>)->Apply(common_args);
+BENCHMARK(bm_sort<std::int32_t, AlgType::StdStable>)->Apply(common_args);
+BENCHMARK(bm_sort<std::int32_t, AlgType::StdPar>)->Apply(common_args)->UseRealTime();
+BENCHMARK(bm_sort<std::int32_t, AlgType::StdPar, std::greater<>>)->Apply(common_args)->UseRealTime();
+BENCHMARK(bm_sort<std::int64_t, AlgType::Std>)->Apply(common_args);
+
+BENCHMARK(bm_sort<std::uint8_t, AlgType::Std>)->Apply(common_args);
+BENCHMARK(bm_sort<std::uint8_t, AlgType::Rng>)->Apply(common_args);
+BENCHMARK(bm_sort<std::uint16_t, AlgType::Std>)->Apply(common_args);
+BENCHMARK(bm_sort<std::uint16_t, AlgType::StdStable>)->Apply(common_args);
+BENCHMARK(bm_sort<std::uint32_t, AlgType::Std>)->Apply(common_args);
+BENCHMARK(bm_sort<std::uint64_t, AlgType::Std>)->Apply(common_args);
+
+BENCHMARK(bm_sort<float, AlgType::Std>)->Apply(common_args);
+BENCHMARK(bm_sort<float, AlgType::Rng>)->Apply(common_args);
+BENCHMARK(bm_sort<double, AlgType::Std>)->Apply(common_args);
+BENCHMARK(bm_sort<double, AlgType::Std, std::greater<>>)->Apply(common_args);
+BENCHMARK(bm_sort<double, AlgType::StdPar>)->Apply(common_args)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -53,6 +53,10 @@ _CONSTEXPR20 void push_heap(_RanIt _First, _RanIt _Last) {
     _STD push_heap(_First, _Last, less<>{});
 }
 
+template <class _RanIt, class _Pr>
+constexpr bool _Is_heap_child_select_branchless = // Select the larger child without branching?
+    is_scalar_v<_Iter_value_t<_RanIt>> && (_Is_predicate_less<_RanIt, _Pr> || _Is_predicate_greater<_RanIt, _Pr>);
+
 template <class _RanIt, class _Ty, class _Pr>
 _CONSTEXPR20 void _Pop_heap_hole_by_index(
     _RanIt _First, _Iter_diff_t<_RanIt> _Hole, _Iter_diff_t<_RanIt> _Bottom, _Ty&& _Val, _Pr _Pred) {
@@ -68,7 +72,10 @@ _CONSTEXPR20 void _Pop_heap_hole_by_index(
     const _Diff _Max_sequence_non_leaf = (_Bottom - 1) >> 1; // shift for codegen
     while (_Idx < _Max_sequence_non_leaf) { // move _Hole down to larger child
         _Idx = 2 * _Idx + 2;
-        if (_DEBUG_LT_PRED(_Pred, *(_First + _Idx), *(_First + (_Idx - 1)))) {
+        if constexpr (_Is_heap_child_select_branchless<_RanIt, _Pr>) {
+            // The larger child is essentially random, so avoid a mispredicted branch; see GH-2334
+            _Idx -= static_cast<_Diff>(_DEBUG_LT_PRED(_Pred, *(_First + _Idx), *(_First + (_Idx - 1))));
+        } else if (_DEBUG_LT_PRED(_Pred, *(_First + _Idx), *(_First + (_Idx - 1)))) {
             --_Idx;
         }
         *(_First + _Hole) = _STD move(*(_First + _Idx));
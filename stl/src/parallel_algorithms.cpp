@@ -7,6 +7,66 @@
 #include <thread>
 #include <xatomic_wait.h>
 
+// When set, the threadpool work entry points below are backed by the portable work-stealing pool in
+// work_stealing_pool.hpp instead of the Windows threadpool.
+#ifndef _STL_WORK_STEALING_THREADPOOL
+#define _STL_WORK_STEALING_THREADPOOL 0
+#endif // !defined(_STL_WORK_STEALING_THREADPOOL)
+
+#if _STL_WORK_STEALING_THREADPOOL
+#include <atomic>
+
+#include "work_stealing_pool.hpp"
+
+namespace {
+    struct _Portable_threadpool_work : _Pool_work {
+        _Portable_threadpool_work(
+            _Work_stealing_pool& _Pool_, const PTP_WORK_CALLBACK _Callback_, void* const _Context_) noexcept
+            : _Pool_work(&_Invoke_callback), _Pool(_Pool_), _Callback(_Callback_), _Context(_Context_) {}
+
+        static void _Invoke_callback(_Pool_work& _Work) noexcept {
+            auto& _Self = static_cast<_Portable_threadpool_work&>(_Work);
+            _Self._Callback(nullptr, _Self._Context, reinterpret_cast<PTP_WORK>(&_Self));
+        }
+
+        _Work_stealing_pool& _Pool;
+        PTP_WORK_CALLBACK _Callback;
+        void* _Context;
+    };
+
+    [[nodiscard]] _Portable_threadpool_work& _Get_portable_work(const PTP_WORK _Work) noexcept {
+        return *reinterpret_cast<_Portable_threadpool_work*>(_Work);
+    }
+
+    _STD atomic<_Work_stealing_pool*> _Shared_pool{nullptr};
+
+    [[nodiscard]] _Work_stealing_pool* _Get_shared_pool() noexcept {
+        // not a function-local static, as this library is built with /Zc:threadSafeInit-
+        auto _Pool = _Shared_pool.load(_STD memory_order_acquire);
+        if (_Pool) {
+            return _Pool;
+        }
+
+        try {
+            // the submitting thread runs chunks too, so one fewer worker than hardware threads is enough
+            const unsigned int _Hw_threads = _STD thread::hardware_concurrency();
+            _Pool                          = new _Work_stealing_pool(_Hw_threads > 1 ? _Hw_threads - 1 : 1);
+        } catch (...) {
+            return nullptr;
+        }
+
+        // the pool is intentionally never destroyed; joining its workers during DLL unload could deadlock
+        _Work_stealing_pool* _Expected = nullptr;
+        if (!_Shared_pool.compare_exchange_strong(_Expected, _Pool)) {
+            delete _Pool;
+            _Pool = _Expected;
+        }
+
+        return _Pool;
+    }
+} // unnamed namespace
+#endif // _STL_WORK_STEALING_THREADPOOL
+
 extern "C" {
 
 [[nodiscard]] unsigned int __stdcall __std_parallel_algorithms_hw_threads() noexcept {
@@ -20,6 +80,36 @@ extern "C" {
     return static_cast<unsigned int>(_Hw_concurrency);
 }
 
+#if _STL_WORK_STEALING_THREADPOOL
+[[nodiscard]] PTP_WORK __stdcall __std_create_threadpool_work(
+    PTP_WORK_CALLBACK _Callback, void* _Context, PTP_CALLBACK_ENVIRON) noexcept {
+    const auto _Pool = _Get_shared_pool();
+    if (!_Pool) {
+        return nullptr;
+    }
+
+    return reinterpret_cast<PTP_WORK>(new (_STD nothrow) _Portable_threadpool_work(*_Pool, _Callback, _Context));
+}
+
+void __stdcall __std_submit_threadpool_work(PTP_WORK _Work) noexcept {
+    auto& _Portable_work = _Get_portable_work(_Work);
+    _Portable_work._Pool._Submit(_Portable_work, 1);
+}
+
+void __stdcall __std_bulk_submit_threadpool_work(PTP_WORK _Work, const size_t _Submissions) noexcept {
+    auto& _Portable_work = _Get_portable_work(_Work);
+    _Portable_work._Pool._Submit(_Portable_work, _Submissions);
+}
+
+void __stdcall __std_close_threadpool_work(PTP_WORK _Work) noexcept {
+    delete &_Get_portable_work(_Work);
+}
+
+void __stdcall __std_wait_for_threadpool_work_callbacks(PTP_WORK _Work, BOOL _Cancel) noexcept {
+    auto& _Portable_work = _Get_portable_work(_Work);
+    _Portable_work._Pool._Wait(_Portable_work, _Cancel != FALSE);
+}
+#else // ^^^ _STL_WORK_STEALING_THREADPOOL / !_STL_WORK_STEALING_THREADPOOL vvv
 [[nodiscard]] PTP_WORK __stdcall __std_create_threadpool_work(
     PTP_WORK_CALLBACK _Callback, void* _Context, PTP_CALLBACK_ENVIRON _Callback_environ) noexcept {
     return CreateThreadpoolWork(_Callback, _Context, _Callback_environ);
@@ -42,6 +132,7 @@ void __stdcall __std_close_threadpool_work(PTP_WORK _Work) noexcept {
 void __stdcall __std_wait_for_threadpool_work_callbacks(PTP_WORK _Work, BOOL _Cancel) noexcept {
     WaitForThreadpoolWorkCallbacks(_Work, _Cancel);
 }
+#endif // ^^^ !_STL_WORK_STEALING_THREADPOOL ^^^
 
 void __stdcall __std_execution_wait_on_uchar(const volatile unsigned char* _Address, unsigned char _Compare) noexcept {
     __std_atomic_wait_direct(const_cast<const unsigned char*>(_Address), &_Compare, 1, __std_atomic_wait_no_timeout);
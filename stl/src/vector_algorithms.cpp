@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <cstring>
 #include <cwchar>
+#include <limits>
 #include <type_traits>
 
 #if !defined(_M_ARM64) && !defined(_M_ARM64EC)
@@ -28,6 +29,13 @@ extern "C" long __isa_enabled;
 
 namespace {
 #if !defined(_M_ARM64) && !defined(_M_ARM64EC)
+    bool _Use_avx512() noexcept {
+        // The AVX512 level means AVX512F, AVX512CD, AVX512BW, AVX512DQ, and AVX512VL. Also require AVX2,
+        // so that masking off AVX2 (as the tests do) turns off both tiers.
+        constexpr long _Both = (1 << __ISA_AVAILABLE_AVX512) | (1 << __ISA_AVAILABLE_AVX2);
+        return (__isa_enabled & _Both) == _Both;
+    }
+
     bool _Use_avx2() noexcept {
         return __isa_enabled & (1 << __ISA_AVAILABLE_AVX2);
     }
@@ -54,6 +62,21 @@ namespace {
         return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(
             reinterpret_cast<const unsigned char*>(_Tail_masks) + (32 - _Count_in_bytes)));
     }
+
+    uint64_t _Avx512_tail_mask(const size_t _Count_in_elements) noexcept {
+        // _Count_in_elements must be within [0, 64).
+        return (uint64_t{1} << _Count_in_elements) - 1;
+    }
+
+    unsigned long _Countr_zero_64(const uint64_t _Val) noexcept {
+        // _Val must be nonzero.
+#ifdef _M_IX86
+        const uint32_t _Low = static_cast<uint32_t>(_Val);
+        return _Low != 0 ? _tzcnt_u32(_Low) : 32 + _tzcnt_u32(static_cast<uint32_t>(_Val >> 32));
+#else // ^^^ defined(_M_IX86) / defined(_M_X64) vvv
+        return static_cast<unsigned long>(_tzcnt_u64(_Val));
+#endif // ^^^ defined(_M_X64) ^^^
+    }
 #endif // ^^^ !defined(_M_ARM64) && !defined(_M_ARM64EC) ^^^
 
     size_t _Byte_length(const void* const _First, const void* const _Last) noexcept {
@@ -2560,6 +2583,202 @@ namespace {
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
             return _Is_sorted_until_impl<typename _Traits::_Scalar, _Ty>(_First, _Last, _Greater);
         }
+
+#ifndef _M_ARM64EC
+        // The children of parents [_Idx, _Idx + N) are [2 * _Idx + 1, 2 * _Idx + 1 + 2 * N).
+        // _Heap_parents_lo and _Heap_parents_hi repeat each parent twice, to line it up with both of its children.
+        template <class _Ty>
+        __m128i _Heap_parents_lo(const __m128i _Val) noexcept {
+            if constexpr (sizeof(_Ty) == 1) {
+                return _mm_unpacklo_epi8(_Val, _Val);
+            } else if constexpr (sizeof(_Ty) == 2) {
+                return _mm_unpacklo_epi16(_Val, _Val);
+            } else if constexpr (sizeof(_Ty) == 4) {
+                return _mm_unpacklo_epi32(_Val, _Val);
+            } else {
+                return _mm_unpacklo_epi64(_Val, _Val);
+            }
+        }
+
+        template <class _Ty>
+        __m128i _Heap_parents_hi(const __m128i _Val) noexcept {
+            if constexpr (sizeof(_Ty) == 1) {
+                return _mm_unpackhi_epi8(_Val, _Val);
+            } else if constexpr (sizeof(_Ty) == 2) {
+                return _mm_unpackhi_epi16(_Val, _Val);
+            } else if constexpr (sizeof(_Ty) == 4) {
+                return _mm_unpackhi_epi32(_Val, _Val);
+            } else {
+                return _mm_unpackhi_epi64(_Val, _Val);
+            }
+        }
+
+        template <class _Ty>
+        __m128 _Heap_parents_lo(const __m128 _Val) noexcept {
+            return _mm_unpacklo_ps(_Val, _Val);
+        }
+
+        template <class _Ty>
+        __m128 _Heap_parents_hi(const __m128 _Val) noexcept {
+            return _mm_unpackhi_ps(_Val, _Val);
+        }
+
+        template <class _Ty>
+        __m128d _Heap_parents_lo(const __m128d _Val) noexcept {
+            return _mm_unpacklo_pd(_Val, _Val);
+        }
+
+        template <class _Ty>
+        __m128d _Heap_parents_hi(const __m128d _Val) noexcept {
+            return _mm_unpackhi_pd(_Val, _Val);
+        }
+
+        // AVX2 unpacking works within 128-bit lanes, so the 64-bit quarters are first reordered as 0, 2, 1, 3;
+        // then unpacking the low halves of the lanes repeats quarters 0 and 1, and the high halves quarters 2 and 3.
+        template <class _Ty>
+        __m256i _Heap_parents_lo(const __m256i _Val) noexcept {
+            const __m256i _Perm = _mm256_permute4x64_epi64(_Val, _MM_SHUFFLE(3, 1, 2, 0));
+            if constexpr (sizeof(_Ty) == 1) {
+                return _mm256_unpacklo_epi8(_Perm, _Perm);
+            } else if constexpr (sizeof(_Ty) == 2) {
+                return _mm256_unpacklo_epi16(_Perm, _Perm);
+            } else if constexpr (sizeof(_Ty) == 4) {
+                return _mm256_unpacklo_epi32(_Perm, _Perm);
+            } else {
+                return _mm256_unpacklo_epi64(_Perm, _Perm);
+            }
+        }
+
+        template <class _Ty>
+        __m256i _Heap_parents_hi(const __m256i _Val) noexcept {
+            const __m256i _Perm = _mm256_permute4x64_epi64(_Val, _MM_SHUFFLE(3, 1, 2, 0));
+            if constexpr (sizeof(_Ty) == 1) {
+                return _mm256_unpackhi_epi8(_Perm, _Perm);
+            } else if constexpr (sizeof(_Ty) == 2) {
+                return _mm256_unpackhi_epi16(_Perm, _Perm);
+            } else if constexpr (sizeof(_Ty) == 4) {
+                return _mm256_unpackhi_epi32(_Perm, _Perm);
+            } else {
+                return _mm256_unpackhi_epi64(_Perm, _Perm);
+            }
+        }
+
+        template <class _Ty>
+        __m256 _Heap_parents_lo(const __m256 _Val) noexcept {
+            const __m256 _Perm =
+                _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_Val), _MM_SHUFFLE(3, 1, 2, 0)));
+            return _mm256_unpacklo_ps(_Perm, _Perm);
+        }
+
+        template <class _Ty>
+        __m256 _Heap_parents_hi(const __m256 _Val) noexcept {
+            const __m256 _Perm =
+                _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_Val), _MM_SHUFFLE(3, 1, 2, 0)));
+            return _mm256_unpackhi_ps(_Perm, _Perm);
+        }
+
+        template <class _Ty>
+        __m256d _Heap_parents_lo(const __m256d _Val) noexcept {
+            return _mm256_permute4x64_pd(_Val, _MM_SHUFFLE(1, 1, 0, 0));
+        }
+
+        template <class _Ty>
+        __m256d _Heap_parents_hi(const __m256d _Val) noexcept {
+            return _mm256_permute4x64_pd(_Val, _MM_SHUFFLE(3, 3, 2, 2));
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <class _Traits, class _Ty>
+        const void* _Is_heap_until_impl(
+            const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+            const auto _First_ptr = static_cast<const _Ty*>(_First);
+            const size_t _Size    = static_cast<size_t>(static_cast<const _Ty*>(_Last) - _First_ptr);
+            size_t _Child         = 1;
+
+            if constexpr (_Traits::_Vectorized) {
+#ifdef _M_ARM64EC
+                static_assert(false, "No vectorization for _M_ARM64EC yet");
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+                [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+
+                constexpr bool _Sign_cor  = static_cast<_Ty>(-1) > _Ty{0};
+                constexpr size_t _Per_vec = _Traits::_Vec_size / sizeof(_Ty);
+
+                // Each step checks _Per_vec consecutive parents against their 2 * _Per_vec consecutive children
+                for (size_t _Parent = 0; _Size - _Child >= 2 * _Per_vec; _Parent += _Per_vec) {
+                    auto _Parents  = _Traits::_Load(_First_ptr + _Parent);
+                    auto _Children = _Traits::_Load(_First_ptr + _Child);
+                    auto _Next     = _Traits::_Load(_First_ptr + _Child + _Per_vec);
+
+                    if constexpr (_Sign_cor) {
+                        _Parents  = _Traits::_Sign_correction(_Parents, false);
+                        _Children = _Traits::_Sign_correction(_Children, false);
+                        _Next     = _Traits::_Sign_correction(_Next, false);
+                    }
+
+                    const auto _Parents_lo = _Heap_parents_lo<_Ty>(_Parents);
+                    const auto _Parents_hi = _Heap_parents_hi<_Ty>(_Parents);
+
+                    // A child breaks the heap if the parent goes before it
+                    const auto _Bad_lo = _Greater ? _Traits::_Cmp_gt(_Parents_lo, _Children)
+                                                  : _Traits::_Cmp_gt(_Children, _Parents_lo);
+                    const auto _Bad_hi =
+                        _Greater ? _Traits::_Cmp_gt(_Parents_hi, _Next) : _Traits::_Cmp_gt(_Next, _Parents_hi);
+
+                    const unsigned long _Mask_lo = _Traits::_Mask(_Traits::_Mask_cast(_Bad_lo));
+                    const unsigned long _Mask_hi = _Traits::_Mask(_Traits::_Mask_cast(_Bad_hi));
+
+                    if ((_Mask_lo | _Mask_hi) != 0) {
+                        unsigned long _H_pos;
+                        const void* _Result = _First_ptr + _Child;
+
+                        if (_Mask_lo != 0) {
+                            // CodeQL [SM02313] _H_pos is always initialized: we just tested `if (_Mask_lo != 0)`.
+                            _BitScanForward(&_H_pos, _Mask_lo);
+                        } else {
+                            // CodeQL [SM02313] _H_pos is always initialized: _Mask_hi is nonzero here.
+                            _BitScanForward(&_H_pos, _Mask_hi);
+                            _Advance_bytes(_Result, _Traits::_Vec_size);
+                        }
+
+                        _Advance_bytes(_Result, _H_pos);
+                        return _Result;
+                    }
+
+                    _Child += 2 * _Per_vec;
+                }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            }
+
+            for (; _Child != _Size; ++_Child) {
+                const _Ty _Parent_val = _First_ptr[(_Child - 1) >> 1];
+                if (_Greater ? _First_ptr[_Child] < _Parent_val : _Parent_val < _First_ptr[_Child]) {
+                    return _First_ptr + _Child;
+                }
+            }
+
+            return _Last;
+        }
+
+        template <class _Traits, class _Ty>
+        const void* __stdcall _Is_heap_until_disp(
+            const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+            if (_Byte_length(_First, _Last) <= sizeof(_Ty)) {
+                return _Last;
+            }
+
+#ifndef _M_ARM64EC
+            // Vectorization needs the root and at least two vectors of children
+            if (_Byte_length(_First, _Last) > 64 && _Use_avx2()) {
+                return _Is_heap_until_impl<typename _Traits::_Avx, _Ty>(_First, _Last, _Greater);
+            }
+
+            if (_Byte_length(_First, _Last) > 32 && _Use_sse42()) {
+                return _Is_heap_until_impl<typename _Traits::_Sse, _Ty>(_First, _Last, _Greater);
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            return _Is_heap_until_impl<typename _Traits::_Scalar, _Ty>(_First, _Last, _Greater);
+        }
     } // namespace _Sorting
 } // unnamed namespace
 
@@ -2825,6 +3044,56 @@ const void* __stdcall __std_is_sorted_until_d(
     return _Sorting::_Is_sorted_until_disp<_Sorting::_Traits_d, double>(_First, _Last, _Greater);
 }
 
+const void* __stdcall __std_is_heap_until_1i(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Sorting::_Is_heap_until_disp<_Sorting::_Traits_1, int8_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_1u(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Sorting::_Is_heap_until_disp<_Sorting::_Traits_1, uint8_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_2i(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Sorting::_Is_heap_until_disp<_Sorting::_Traits_2, int16_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_2u(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Sorting::_Is_heap_until_disp<_Sorting::_Traits_2, uint16_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_4i(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Sorting::_Is_heap_until_disp<_Sorting::_Traits_4, int32_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_4u(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Sorting::_Is_heap_until_disp<_Sorting::_Traits_4, uint32_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_8i(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Sorting::_Is_heap_until_disp<_Sorting::_Traits_8, int64_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_8u(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Sorting::_Is_heap_until_disp<_Sorting::_Traits_8, uint64_t>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_f(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Sorting::_Is_heap_until_disp<_Sorting::_Traits_f, float>(_First, _Last, _Greater);
+}
+
+const void* __stdcall __std_is_heap_until_d(
+    const void* const _First, const void* const _Last, const bool _Greater) noexcept {
+    return _Sorting::_Is_heap_until_disp<_Sorting::_Traits_d, double>(_First, _Last, _Greater);
+}
+
 } // extern "C"
 
 namespace {
@@ -2836,6 +3105,18 @@ namespace {
         using _Find_traits_8 = void;
 #else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
         struct _Find_traits_1 {
+            static __m512i _Set_avx512(const uint8_t _Val) noexcept {
+                return _mm512_set1_epi8(static_cast<char>(_Val));
+            }
+
+            static __m512i _Load_avx512(const void* const _Src, const uint64_t _Mask) noexcept {
+                return _mm512_maskz_loadu_epi8(static_cast<__mmask64>(_Mask), _Src);
+            }
+
+            static uint64_t _Cmp_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+                return _mm512_cmpeq_epi8_mask(_Lhs, _Rhs);
+            }
+
             static __m256i _Set_avx(const uint8_t _Val) noexcept {
                 return _mm256_set1_epi8(_Val);
             }
@@ -2854,6 +3135,18 @@ namespace {
         };
 
         struct _Find_traits_2 {
+            static __m512i _Set_avx512(const uint16_t _Val) noexcept {
+                return _mm512_set1_epi16(static_cast<short>(_Val));
+            }
+
+            static __m512i _Load_avx512(const void* const _Src, const uint64_t _Mask) noexcept {
+                return _mm512_maskz_loadu_epi16(static_cast<__mmask32>(_Mask), _Src);
+            }
+
+            static uint64_t _Cmp_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+                return _mm512_cmpeq_epi16_mask(_Lhs, _Rhs);
+            }
+
             static __m256i _Set_avx(const uint16_t _Val) noexcept {
                 return _mm256_set1_epi16(_Val);
             }
@@ -2872,6 +3165,18 @@ namespace {
         };
 
         struct _Find_traits_4 {
+            static __m512i _Set_avx512(const uint32_t _Val) noexcept {
+                return _mm512_set1_epi32(static_cast<int>(_Val));
+            }
+
+            static __m512i _Load_avx512(const void* const _Src, const uint64_t _Mask) noexcept {
+                return _mm512_maskz_loadu_epi32(static_cast<__mmask16>(_Mask), _Src);
+            }
+
+            static uint64_t _Cmp_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+                return _mm512_cmpeq_epi32_mask(_Lhs, _Rhs);
+            }
+
             static __m256i _Set_avx(const uint32_t _Val) noexcept {
                 return _mm256_set1_epi32(_Val);
             }
@@ -2890,6 +3195,18 @@ namespace {
         };
 
         struct _Find_traits_8 {
+            static __m512i _Set_avx512(const uint64_t _Val) noexcept {
+                return _mm512_set1_epi64(static_cast<long long>(_Val));
+            }
+
+            static __m512i _Load_avx512(const void* const _Src, const uint64_t _Mask) noexcept {
+                return _mm512_maskz_loadu_epi64(static_cast<__mmask8>(_Mask), _Src);
+            }
+
+            static uint64_t _Cmp_avx512(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+                return _mm512_cmpeq_epi64_mask(_Lhs, _Rhs);
+            }
+
             static __m256i _Set_avx(const uint64_t _Val) noexcept {
                 return _mm256_set1_epi64x(_Val);
             }
@@ -2929,7 +3246,53 @@ namespace {
 #ifndef _M_ARM64EC
             const size_t _Size_bytes = _Byte_length(_First, _Last);
 
-            if (const size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
+            if (const size_t _Avx512_size = _Size_bytes & ~size_t{0x3F}; _Avx512_size != 0 && _Use_avx512()) {
+                _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+                constexpr uint64_t _All_lanes = ~uint64_t{0} >> (64 - 64 / sizeof(_Ty));
+
+                const __m512i _Comparand = _Traits::_Set_avx512(_Val);
+                const void* _Stop_at     = _First;
+                _Advance_bytes(_Stop_at, _Avx512_size);
+
+                do {
+                    const __m512i _Data = _mm512_loadu_si512(_First);
+                    uint64_t _Bingo     = _Traits::_Cmp_avx512(_Data, _Comparand);
+
+                    if constexpr (_Pred == _Predicate::_Not_equal) {
+                        _Bingo ^= _All_lanes;
+                    }
+
+                    if (_Bingo != 0) {
+                        _Advance_bytes(_First, _Countr_zero_64(_Bingo) * sizeof(_Ty));
+                        return _First;
+                    }
+
+                    _Advance_bytes(_First, 64);
+                } while (_First != _Stop_at);
+
+                // The masked load doesn't touch the elements past the end, so it handles any tail
+                if (const size_t _Tail_count = (_Size_bytes & 0x3F) / sizeof(_Ty); _Tail_count != 0) {
+                    const uint64_t _Tail_mask = _Avx512_tail_mask(_Tail_count);
+                    const __m512i _Data       = _Traits::_Load_avx512(_First, _Tail_mask);
+                    uint64_t _Bingo           = _Traits::_Cmp_avx512(_Data, _Comparand);
+
+                    if constexpr (_Pred == _Predicate::_Not_equal) {
+                        _Bingo ^= _All_lanes;
+                    }
+
+                    _Bingo &= _Tail_mask;
+
+                    if (_Bingo != 0) {
+                        _Advance_bytes(_First, _Countr_zero_64(_Bingo) * sizeof(_Ty));
+                        return _First;
+                    }
+
+                    _Advance_bytes(_First, _Tail_count * sizeof(_Ty));
+                }
+
+                return _First;
+            } else if (const size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
                 _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
 
                 const __m256i _Comparand = _Traits::_Set_avx(_Val);
@@ -3585,6 +3948,10 @@ namespace {
         using _Count_traits_1 = void;
 #else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
         struct _Count_traits_8 : _Finding::_Find_traits_8 {
+            static __m512i _Inc_avx512(const __m512i _Count, const uint64_t _Mask) noexcept {
+                return _mm512_mask_add_epi64(_Count, static_cast<__mmask8>(_Mask), _Count, _mm512_set1_epi64(1));
+            }
+
             static __m256i _Sub_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
                 return _mm256_sub_epi64(_Lhs, _Rhs);
             }
@@ -3593,6 +3960,12 @@ namespace {
                 return _mm_sub_epi64(_Lhs, _Rhs);
             }
 
+            static size_t _Reduce_avx512(const __m512i _Val) noexcept {
+                const __m256i _Lo64 = _mm512_castsi512_si256(_Val);
+                const __m256i _Hi64 = _mm512_extracti64x4_epi64(_Val, 1);
+                return _Reduce_avx(_mm256_add_epi64(_Lo64, _Hi64));
+            }
+
             static size_t _Reduce_avx(const __m256i _Val) noexcept {
                 const __m128i _Lo64 = _mm256_extracti128_si256(_Val, 0);
                 const __m128i _Hi64 = _mm256_extracti128_si256(_Val, 1);
@@ -3616,10 +3989,22 @@ namespace {
             // overflow.
 
             // For SSE4.2, we use hadd_epi32 twice. This would allow a larger limit,
-            // but it's simpler to use the smaller limit for both codepaths.
+            // but it's simpler to use the smaller limit for all codepaths.
+
+            // For AVX-512, we widen the counters to 64 bits before combining them, so the limit isn't reached.
 
             static constexpr size_t _Max_count = 0x1FFF'FFFF;
 
+            static __m512i _Inc_avx512(const __m512i _Count, const uint64_t _Mask) noexcept {
+                return _mm512_mask_add_epi32(_Count, static_cast<__mmask16>(_Mask), _Count, _mm512_set1_epi32(1));
+            }
+
+            static size_t _Reduce_avx512(const __m512i _Val) noexcept {
+                const __m512i _Lo32 = _mm512_and_si512(_Val, _mm512_set1_epi64(0xFFFF'FFFF));
+                const __m512i _Hi32 = _mm512_srli_epi64(_Val, 32);
+                return _Count_traits_8::_Reduce_avx512(_mm512_add_epi64(_Lo32, _Hi32));
+            }
+
             static __m256i _Sub_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
                 return _mm256_sub_epi32(_Lhs, _Rhs);
             }
@@ -3647,9 +4032,19 @@ namespace {
         struct _Count_traits_2 : _Finding::_Find_traits_2 {
             // For both AVX2 and SSE4.2, we use hadd_epi16 once to combine pairs of 16-bit counters into 16-bit results.
             // Therefore, _Max_count is 0x7FFF, which is 0xFFFE when doubled; any more would overflow.
+            // For AVX-512, madd_epi16 treats the counters as signed, which 0x7FFF also satisfies.
 
             static constexpr size_t _Max_count = 0x7FFF;
 
+            static __m512i _Inc_avx512(const __m512i _Count, const uint64_t _Mask) noexcept {
+                return _mm512_mask_add_epi16(_Count, static_cast<__mmask32>(_Mask), _Count, _mm512_set1_epi16(1));
+            }
+
+            static size_t _Reduce_avx512(const __m512i _Val) noexcept {
+                const __m512i _Rx2 = _mm512_madd_epi16(_Val, _mm512_set1_epi16(1));
+                return _Count_traits_4::_Reduce_avx512(_Rx2);
+            }
+
             static __m256i _Sub_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
                 return _mm256_sub_epi16(_Lhs, _Rhs);
             }
@@ -3678,11 +4073,22 @@ namespace {
             // For SSE4.2, _Max_portion_size below is _Max_count * 16 bytes, and we have 1-byte elements.
             // We're using packed 8-bit counters, and 16 of those fit in 128 bits.
 
-            // For both codepaths, this is why _Max_count is the maximum unsigned 8-bit integer.
+            // For AVX-512, _Max_portion_size below is _Max_count * 64 bytes, and 64 of those counters fit in 512 bits.
+
+            // For all codepaths, this is why _Max_count is the maximum unsigned 8-bit integer.
             // (The reduction steps aren't the limiting factor here.)
 
             static constexpr size_t _Max_count = 0xFF;
 
+            static __m512i _Inc_avx512(const __m512i _Count, const uint64_t _Mask) noexcept {
+                return _mm512_mask_add_epi8(_Count, static_cast<__mmask64>(_Mask), _Count, _mm512_set1_epi8(1));
+            }
+
+            static size_t _Reduce_avx512(const __m512i _Val) noexcept {
+                const __m512i _Rx1 = _mm512_sad_epu8(_Val, _mm512_setzero_si512());
+                return _Count_traits_8::_Reduce_avx512(_Rx1);
+            }
+
             static __m256i _Sub_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
                 return _mm256_sub_epi8(_Lhs, _Rhs);
             }
@@ -3711,7 +4117,51 @@ namespace {
 #ifndef _M_ARM64EC
             const size_t _Size_bytes = _Byte_length(_First, _Last);
 
-            if (size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
+            if (size_t _Avx512_size = _Size_bytes & ~size_t{0x3F}; _Avx512_size != 0 && _Use_avx512()) {
+                const __m512i _Comparand = _Traits::_Set_avx512(_Val);
+                const void* _Stop_at     = _First;
+
+                for (;;) {
+                    if constexpr (sizeof(_Ty) >= sizeof(size_t)) {
+                        _Advance_bytes(_Stop_at, _Avx512_size);
+                    } else {
+                        constexpr size_t _Max_portion_size = _Traits::_Max_count * 64;
+                        const size_t _Portion_size =
+                            _Avx512_size < _Max_portion_size ? _Avx512_size : _Max_portion_size;
+                        _Advance_bytes(_Stop_at, _Portion_size);
+                        _Avx512_size -= _Portion_size;
+                    }
+
+                    __m512i _Count_vector = _mm512_setzero_si512();
+
+                    do {
+                        const __m512i _Data = _mm512_loadu_si512(_First);
+                        _Count_vector = _Traits::_Inc_avx512(_Count_vector, _Traits::_Cmp_avx512(_Data, _Comparand));
+                        _Advance_bytes(_First, 64);
+                    } while (_First != _Stop_at);
+
+                    _Result += _Traits::_Reduce_avx512(_Count_vector);
+
+                    if constexpr (sizeof(_Ty) >= sizeof(size_t)) {
+                        break;
+                    } else {
+                        if (_Avx512_size == 0) {
+                            break;
+                        }
+                    }
+                }
+
+                if (const size_t _Tail_count = (_Size_bytes & 0x3F) / sizeof(_Ty); _Tail_count != 0) {
+                    const uint64_t _Tail_mask = _Avx512_tail_mask(_Tail_count);
+                    const __m512i _Data       = _Traits::_Load_avx512(_First, _Tail_mask);
+                    const uint64_t _Bingo     = _Traits::_Cmp_avx512(_Data, _Comparand) & _Tail_mask;
+                    _Result += _Traits::_Reduce_avx512(_Traits::_Inc_avx512(_mm512_setzero_si512(), _Bingo));
+                }
+
+                _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+
+                return _Result;
+            } else if (size_t _Avx_size = _Size_bytes & ~size_t{0x1F}; _Avx_size != 0 && _Use_avx2()) {
                 const __m256i _Comparand = _Traits::_Set_avx(_Val);
                 const void* _Stop_at     = _First;
 
@@ -5627,6 +6077,46 @@ namespace {
                 return _Last1;
             }
         }
+
+        // Finds the first position in [_First1, _Last1) where the first and the last byte of the needle both match,
+        // and the bytes between them match too. Processes 32 candidate positions at a time, as long as both loads
+        // stay within the haystack; returns nullptr and advances _First1 past the processed positions otherwise.
+        const void* _Search_first_last_avx2(const void*& _First1, const void* const _Last1,
+            const void* const _First2, const size_t _Size_bytes_2) noexcept {
+            _Zeroupper_on_exit _Guard; // TRANSITION, DevCom-10331414
+
+            const auto _Ptr2         = static_cast<const unsigned char*>(_First2);
+            const size_t _Last_off   = _Size_bytes_2 - 1;
+            const __m256i _First_val = _mm256_set1_epi8(static_cast<char>(_Ptr2[0]));
+            const __m256i _Last_val  = _mm256_set1_epi8(static_cast<char>(_Ptr2[_Last_off]));
+
+            const size_t _Positions = _Byte_length(_First1, _Last1) - _Last_off;
+            const void* _Stop1      = _First1;
+            _Advance_bytes(_Stop1, _Positions & ~size_t{0x1F});
+
+            auto _Ptr1 = static_cast<const unsigned char*>(_First1);
+            for (; _Ptr1 != _Stop1; _Ptr1 += 32) {
+                const __m256i _Data_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Ptr1));
+                const __m256i _Data_last  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Ptr1 + _Last_off));
+                const __m256i _Both       = _mm256_and_si256(
+                    _mm256_cmpeq_epi8(_Data_first, _First_val), _mm256_cmpeq_epi8(_Data_last, _Last_val));
+
+                unsigned int _Bingo = static_cast<unsigned int>(_mm256_movemask_epi8(_Both));
+                while (_Bingo != 0) {
+                    const unsigned int _Pos = _tzcnt_u32(_Bingo);
+                    const auto _Match       = _Ptr1 + _Pos;
+
+                    if (_Size_bytes_2 <= 2 || memcmp(_Match + 1, _Ptr2 + 1, _Size_bytes_2 - 2) == 0) {
+                        return _Match;
+                    }
+
+                    _Bingo ^= 1 << _Pos;
+                }
+            }
+
+            _First1 = _Ptr1;
+            return nullptr;
+        }
 #endif // ^^^ !defined(_M_ARM64EC) ^^^
 
         template <class _FindTraits, class _Traits_avx, class _Traits_sse, class _Ty>
@@ -5641,7 +6131,7 @@ namespace {
                     _First1, _Last1, *static_cast<const _Ty*>(_First2));
             }
 
-            const size_t _Size_bytes_1 = _Byte_length(_First1, _Last1);
+            size_t _Size_bytes_1       = _Byte_length(_First1, _Last1);
             const size_t _Size_bytes_2 = _Count2 * sizeof(_Ty);
 
             if (_Size_bytes_1 < _Size_bytes_2) {
@@ -5649,6 +6139,22 @@ namespace {
             }
 
 #ifndef _M_ARM64EC
+            if constexpr (sizeof(_Ty) == 1) {
+                // Filtering by both the first and the last needle byte rejects far more false candidates than
+                // filtering by the first byte alone, which is what makes the byte search worth doing with AVX2.
+                // The remaining positions, less than a vector of them, go to the SSE4.2 path below.
+                if (_Use_avx2() && _Size_bytes_1 - _Size_bytes_2 >= 32) {
+                    if (const auto _Match = _Search_first_last_avx2(_First1, _Last1, _First2, _Size_bytes_2)) {
+                        return _Match;
+                    }
+
+                    _Size_bytes_1 = _Byte_length(_First1, _Last1);
+                    if (_Size_bytes_1 < _Size_bytes_2) {
+                        return _Last1; // every candidate position has been processed
+                    }
+                }
+            }
+
             // The AVX2 path for 8-bit elements is not necessarily more efficient than the SSE4.2 cmpestri path
             if constexpr (sizeof(_Ty) != 1) {
                 if (_Use_avx2() && _Size_bytes_1 >= 32) {
@@ -6432,26 +6938,79 @@ namespace {
             }
         };
 
-        struct _Avx_4 {
+        // Compressing in a register and then storing the whole vector is much faster than compressing to memory
+        // on some CPUs. The full store is fine for the same reason as for the AVX2 permutation below.
+        // The lanes past the kept elements retain the source values, as _Unique_impl rereads the last one.
+        struct _Avx512_4 {
             static constexpr size_t _Elem_size = 4;
-            static constexpr size_t _Step      = 32;
+            static constexpr size_t _Step      = 64;
 
-            static __m256i _Set(const uint32_t _Val) noexcept {
-                return _mm256_set1_epi32(_Val);
+            static __m512i _Set(const uint32_t _Val) noexcept {
+                return _mm512_set1_epi32(static_cast<int>(_Val));
             }
 
-            static __m256i _Load(const void* const _Ptr) noexcept {
-                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Ptr));
+            static __m512i _Load(const void* const _Ptr) noexcept {
+                return _mm512_loadu_si512(_Ptr);
             }
 
-            static uint32_t _Mask(const __m256i _First, const __m256i _Second) noexcept {
-                const __m256i _Mask = _mm256_cmpeq_epi32(_First, _Second);
-                return _mm256_movemask_ps(_mm256_castsi256_ps(_Mask));
+            static uint32_t _Mask(const __m512i _First, const __m512i _Second) noexcept {
+                return _mm512_cmpeq_epi32_mask(_First, _Second);
             }
 
-            static void* _Store_masked(void* _Out, const __m256i _Src, const uint32_t _Bingo) noexcept {
-                const __m256i _Shuf = _mm256_cvtepu8_epi32(_mm_loadu_si64(_Tables_4_avx._Shuf[_Bingo]));
-                const __m256i _Dest = _mm256_permutevar8x32_epi32(_Src, _Shuf);
+            static void* _Store_masked(void* _Out, const __m512i _Src, const uint32_t _Bingo) noexcept {
+                const uint32_t _Keep = _Bingo ^ 0xFFFF;
+                const __m512i _Dest  = _mm512_mask_compress_epi32(_Src, static_cast<__mmask16>(_Keep), _Src);
+                _mm512_storeu_si512(_Out, _Dest);
+                _Advance_bytes(_Out, __popcnt(_Keep) * 4); // Assume available with SSE4.2
+                return _Out;
+            }
+        };
+
+        struct _Avx512_8 {
+            static constexpr size_t _Elem_size = 8;
+            static constexpr size_t _Step      = 64;
+
+            static __m512i _Set(const uint64_t _Val) noexcept {
+                return _mm512_set1_epi64(static_cast<long long>(_Val));
+            }
+
+            static __m512i _Load(const void* const _Ptr) noexcept {
+                return _mm512_loadu_si512(_Ptr);
+            }
+
+            static uint32_t _Mask(const __m512i _First, const __m512i _Second) noexcept {
+                return _mm512_cmpeq_epi64_mask(_First, _Second);
+            }
+
+            static void* _Store_masked(void* _Out, const __m512i _Src, const uint32_t _Bingo) noexcept {
+                const uint32_t _Keep = _Bingo ^ 0xFF;
+                const __m512i _Dest  = _mm512_mask_compress_epi64(_Src, static_cast<__mmask8>(_Keep), _Src);
+                _mm512_storeu_si512(_Out, _Dest);
+                _Advance_bytes(_Out, __popcnt(_Keep) * 8); // Assume available with SSE4.2
+                return _Out;
+            }
+        };
+
+        struct _Avx_4 {
+            static constexpr size_t _Elem_size = 4;
+            static constexpr size_t _Step      = 32;
+
+            static __m256i _Set(const uint32_t _Val) noexcept {
+                return _mm256_set1_epi32(_Val);
+            }
+
+            static __m256i _Load(const void* const _Ptr) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Ptr));
+            }
+
+            static uint32_t _Mask(const __m256i _First, const __m256i _Second) noexcept {
+                const __m256i _Mask = _mm256_cmpeq_epi32(_First, _Second);
+                return _mm256_movemask_ps(_mm256_castsi256_ps(_Mask));
+            }
+
+            static void* _Store_masked(void* _Out, const __m256i _Src, const uint32_t _Bingo) noexcept {
+                const __m256i _Shuf = _mm256_cvtepu8_epi32(_mm_loadu_si64(_Tables_4_avx._Shuf[_Bingo]));
+                const __m256i _Dest = _mm256_permutevar8x32_epi32(_Src, _Shuf);
                 _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Out), _Dest);
                 _Advance_bytes(_Out, _Tables_4_avx._Size[_Bingo]);
                 return _Out;
@@ -6667,7 +7226,14 @@ void* __stdcall __std_remove_4(void* _First, void* const _Last, const uint32_t _
     void* _Out = _First;
 
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Out   = _Removing::_Remove_impl<_Removing::_Avx512_4>(_First, _Stop, _Val);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_avx2() && _Size_bytes >= 32) {
         void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
         _Out   = _Removing::_Remove_impl<_Removing::_Avx_4>(_First, _Stop, _Val);
@@ -6689,7 +7255,14 @@ void* __stdcall __std_remove_8(void* _First, void* const _Last, const uint64_t _
     void* _Out = _First;
 
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Out   = _Removing::_Remove_impl<_Removing::_Avx512_8>(_First, _Stop, _Val);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_avx2() && _Size_bytes >= 32) {
         void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
         _Out   = _Removing::_Remove_impl<_Removing::_Avx_8>(_First, _Stop, _Val);
@@ -6738,7 +7311,14 @@ void* __stdcall __std_remove_copy_2(
 void* __stdcall __std_remove_copy_4(
     const void* _First, const void* const _Last, void* _Out, const uint32_t _Val) noexcept {
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Out   = _Removing::_Remove_copy_impl<_Removing::_Avx512_4>(_First, _Stop, _Out, _Val);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_avx2() && _Size_bytes >= 32) {
         const void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
         _Out   = _Removing::_Remove_copy_impl<_Removing::_Avx_4>(_First, _Stop, _Out, _Val);
@@ -6759,7 +7339,14 @@ void* __stdcall __std_remove_copy_4(
 void* __stdcall __std_remove_copy_8(
     const void* _First, const void* const _Last, void* _Out, const uint64_t _Val) noexcept {
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Out   = _Removing::_Remove_copy_impl<_Removing::_Avx512_8>(_First, _Stop, _Out, _Val);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_avx2() && _Size_bytes >= 32) {
         const void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
         _Out   = _Removing::_Remove_copy_impl<_Removing::_Avx_8>(_First, _Stop, _Out, _Val);
@@ -6832,7 +7419,14 @@ void* __stdcall __std_unique_4(void* _First, void* const _Last) noexcept {
     _Advance_bytes(_First, 4);
 
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Dest  = _Removing::_Unique_impl<_Removing::_Avx512_4>(_First, _Stop);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_avx2() && _Size_bytes >= 32) {
         void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
         _Dest  = _Removing::_Unique_impl<_Removing::_Avx_4>(_First, _Stop);
@@ -6861,7 +7455,14 @@ void* __stdcall __std_unique_8(void* _First, void* const _Last) noexcept {
     _Advance_bytes(_First, 8);
 
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Dest  = _Removing::_Unique_impl<_Removing::_Avx512_8>(_First, _Stop);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_avx2() && _Size_bytes >= 32) {
         void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
         _Dest  = _Removing::_Unique_impl<_Removing::_Avx_8>(_First, _Stop);
@@ -6928,7 +7529,14 @@ void* __stdcall __std_unique_copy_4(const void* _First, const void* const _Last,
     _Advance_bytes(_First, 4);
 
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Avx512_4>(_First, _Stop, _Dest);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_avx2() && _Size_bytes >= 32) {
         const void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
         _Dest  = _Removing::_Unique_copy_impl<_Removing::_Avx_4>(_First, _Stop, _Dest);
@@ -6955,7 +7563,14 @@ void* __stdcall __std_unique_copy_8(const void* _First, const void* const _Last,
     _Advance_bytes(_First, 8);
 
 #ifndef _M_ARM64EC
-    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx2() && _Size_bytes >= 32) {
+    if (const size_t _Size_bytes = _Byte_length(_First, _Last); _Use_avx512() && _Size_bytes >= 64) {
+        const void* _Stop = _First;
+        _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x3F});
+        _Dest  = _Removing::_Unique_copy_impl<_Removing::_Avx512_8>(_First, _Stop, _Dest);
+        _First = _Stop;
+
+        _mm256_zeroupper(); // TRANSITION, DevCom-10331414
+    } else if (_Use_avx2() && _Size_bytes >= 32) {
         const void* _Stop = _First;
         _Advance_bytes(_Stop, _Size_bytes & ~size_t{0x1F});
         _Dest  = _Removing::_Unique_copy_impl<_Removing::_Avx_8>(_First, _Stop, _Dest);
@@ -7359,6 +7974,2316 @@ __declspec(noalias) bool __stdcall __std_includes_less_8u(
 
 } // extern "C"
 
+namespace {
+    namespace _Partitioning {
+        // Quicksort subranges of this size or smaller are sorted by a sorting network.
+        constexpr size_t _Leaf_max = 16;
+
+#ifdef _M_ARM64EC
+        using _Traits_1_sse = void;
+        using _Traits_2_sse = void;
+        using _Traits_4_avx = void;
+        using _Traits_4_sse = void;
+        using _Traits_8_avx = void;
+        using _Traits_8_sse = void;
+        using _Traits_f_avx = void;
+        using _Traits_f_sse = void;
+        using _Traits_d_avx = void;
+        using _Traits_d_sse = void;
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+        template <size_t _Size_v, size_t _Size_h>
+        struct _Tables {
+            uint8_t _Shuf[_Size_v][_Size_h];
+        };
+
+        template <size_t _Size_v, size_t _Size_h>
+        constexpr auto _Make_tables(const uint32_t _Ew) {
+            _Tables<_Size_v, _Size_h> _Result;
+
+            for (uint32_t _Vx = 0; _Vx != _Size_v; ++_Vx) {
+                uint32_t _Nx = 0;
+
+                // Make shuffle mask for pshufb / vpermd corresponding to _Vx bit value.
+                // The first pass moves the elements with bits set to the beginning, the second pass moves the rest
+                // after them. Unlike _Removing tables, no element is dropped, so the result is a permutation.
+                for (uint32_t _Pass = 0; _Pass != 2; ++_Pass) {
+                    for (uint32_t _Hx = 0; _Hx != _Size_h / _Ew; ++_Hx) {
+                        if (((_Vx >> _Hx) & 1) != _Pass) {
+                            // Inner loop needed for cases where the shuffle mask operates on element parts rather
+                            // than whole elements; for whole elements there would be one iteration.
+                            for (uint32_t _Ex = 0; _Ex != _Ew; ++_Ex) {
+                                _Result._Shuf[_Vx][_Nx * _Ew + _Ex] = static_cast<uint8_t>(_Hx * _Ew + _Ex);
+                            }
+                            ++_Nx;
+                        }
+                    }
+                }
+            }
+
+            return _Result;
+        }
+
+        constexpr auto _Tables_1_sse = _Make_tables<256, 8>(1);
+        constexpr auto _Tables_2_sse = _Make_tables<256, 16>(2);
+        constexpr auto _Tables_4_sse = _Make_tables<16, 16>(4);
+        constexpr auto _Tables_4_avx = _Make_tables<256, 8>(1);
+        constexpr auto _Tables_8_sse = _Make_tables<4, 16>(8);
+        constexpr auto _Tables_8_avx = _Make_tables<16, 8>(2);
+
+        struct _Traits_sse {
+            using _Guard = char;
+            using _Vec   = __m128i;
+
+            static __m128i _Load(const void* const _Src) noexcept {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src));
+            }
+
+            static void _Store(void* const _Dest, const __m128i _Val) noexcept {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+            }
+        };
+
+        struct _Traits_avx {
+            using _Guard = _Zeroupper_on_exit;
+            using _Vec   = __m256i;
+
+            static __m256i _Load(const void* const _Src) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+            }
+
+            static void _Store(void* const _Dest, const __m256i _Val) noexcept {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+            }
+        };
+
+        struct _Traits_1_sse : _Traits_sse {
+            // Operates on the lower half of the vector, otherwise the table would have 64K entries
+            static constexpr size_t _Lanes = 8;
+
+            static __m128i _Load(const void* const _Src) noexcept {
+                return _mm_loadu_si64(_Src);
+            }
+
+            static void _Store(void* const _Dest, const __m128i _Val) noexcept {
+                _mm_storeu_si64(_Dest, _Val);
+            }
+
+            static __m128i _Set(const uint8_t _Val) noexcept {
+                return _mm_shuffle_epi8(_mm_cvtsi32_si128(_Val), _mm_setzero_si128());
+            }
+
+            static __m128i _Sign_correction(const __m128i _Val) noexcept {
+                return _mm_sub_epi8(_Val, _mm_set1_epi8(static_cast<char>(0x80)));
+            }
+
+            static uint32_t _Mask_gt(const __m128i _First, const __m128i _Second) noexcept {
+                return _mm_movemask_epi8(_mm_cmpgt_epi8(_First, _Second)) & 0xFF;
+            }
+
+            static __m128i _Partition(const __m128i _Val, const uint32_t _Bingo) noexcept {
+                return _mm_shuffle_epi8(_Val, _mm_loadu_si64(_Tables_1_sse._Shuf[_Bingo]));
+            }
+        };
+
+        struct _Traits_2_sse : _Traits_sse {
+            static constexpr size_t _Lanes = 8;
+
+            static __m128i _Set(const uint16_t _Val) noexcept {
+                return _mm_set1_epi16(static_cast<short>(_Val));
+            }
+
+            static __m128i _Sign_correction(const __m128i _Val) noexcept {
+                return _mm_sub_epi16(_Val, _mm_set1_epi16(static_cast<short>(0x8000)));
+            }
+
+            static uint32_t _Mask_gt(const __m128i _First, const __m128i _Second) noexcept {
+                const __m128i _Gt = _mm_cmpgt_epi16(_First, _Second);
+                return _mm_movemask_epi8(_mm_packs_epi16(_Gt, _mm_setzero_si128()));
+            }
+
+            static __m128i _Partition(const __m128i _Val, const uint32_t _Bingo) noexcept {
+                const __m128i _Shuf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Tables_2_sse._Shuf[_Bingo]));
+                return _mm_shuffle_epi8(_Val, _Shuf);
+            }
+        };
+
+        struct _Traits_4_sse : _Traits_sse {
+            static constexpr size_t _Lanes = 4;
+
+            static __m128i _Set(const uint32_t _Val) noexcept {
+                return _mm_set1_epi32(static_cast<int>(_Val));
+            }
+
+            static __m128i _Sign_correction(const __m128i _Val) noexcept {
+                return _mm_sub_epi32(_Val, _mm_set1_epi32(static_cast<int>(0x8000'0000)));
+            }
+
+            static uint32_t _Mask_gt(const __m128i _First, const __m128i _Second) noexcept {
+                return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(_First, _Second)));
+            }
+
+            static __m128i _Partition(const __m128i _Val, const uint32_t _Bingo) noexcept {
+                const __m128i _Shuf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Tables_4_sse._Shuf[_Bingo]));
+                return _mm_shuffle_epi8(_Val, _Shuf);
+            }
+        };
+
+        struct _Traits_4_avx : _Traits_avx {
+            static constexpr size_t _Lanes = 8;
+
+            static __m256i _Set(const uint32_t _Val) noexcept {
+                return _mm256_broadcastd_epi32(_mm_cvtsi32_si128(static_cast<int>(_Val)));
+            }
+
+            static __m256i _Sign_correction(const __m256i _Val) noexcept {
+                return _mm256_sub_epi32(_Val, _mm256_set1_epi32(static_cast<int>(0x8000'0000)));
+            }
+
+            static uint32_t _Mask_gt(const __m256i _First, const __m256i _Second) noexcept {
+                return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(_First, _Second)));
+            }
+
+            static __m256i _Partition(const __m256i _Val, const uint32_t _Bingo) noexcept {
+                const __m256i _Shuf = _mm256_cvtepu8_epi32(_mm_loadu_si64(_Tables_4_avx._Shuf[_Bingo]));
+                return _mm256_permutevar8x32_epi32(_Val, _Shuf);
+            }
+        };
+
+        struct _Traits_8_sse : _Traits_sse {
+            static constexpr size_t _Lanes = 2;
+
+            static __m128i _Set(const uint64_t _Val) noexcept {
+                return _mm_set1_epi64x(static_cast<long long>(_Val));
+            }
+
+            static __m128i _Sign_correction(const __m128i _Val) noexcept {
+                return _mm_sub_epi64(_Val, _mm_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000)));
+            }
+
+            static uint32_t _Mask_gt(const __m128i _First, const __m128i _Second) noexcept {
+                return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(_First, _Second)));
+            }
+
+            static __m128i _Partition(const __m128i _Val, const uint32_t _Bingo) noexcept {
+                const __m128i _Shuf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Tables_8_sse._Shuf[_Bingo]));
+                return _mm_shuffle_epi8(_Val, _Shuf);
+            }
+        };
+
+        struct _Traits_8_avx : _Traits_avx {
+            static constexpr size_t _Lanes = 4;
+
+            static __m256i _Set(const uint64_t _Val) noexcept {
+                return _mm256_set1_epi64x(static_cast<long long>(_Val));
+            }
+
+            static __m256i _Sign_correction(const __m256i _Val) noexcept {
+                return _mm256_sub_epi64(_Val, _mm256_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000)));
+            }
+
+            static uint32_t _Mask_gt(const __m256i _First, const __m256i _Second) noexcept {
+                return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(_First, _Second)));
+            }
+
+            static __m256i _Partition(const __m256i _Val, const uint32_t _Bingo) noexcept {
+                const __m256i _Shuf = _mm256_cvtepu8_epi32(_mm_loadu_si64(_Tables_8_avx._Shuf[_Bingo]));
+                return _mm256_permutevar8x32_epi32(_Val, _Shuf);
+            }
+        };
+
+        struct _Traits_f_sse : _Traits_4_sse {
+            static __m128i _Set(const float _Val) noexcept {
+                return _mm_castps_si128(_mm_set1_ps(_Val));
+            }
+
+            static uint32_t _Mask_gt(const __m128i _First, const __m128i _Second) noexcept {
+                return _mm_movemask_ps(_mm_cmpgt_ps(_mm_castsi128_ps(_First), _mm_castsi128_ps(_Second)));
+            }
+        };
+
+        struct _Traits_f_avx : _Traits_4_avx {
+            static __m256i _Set(const float _Val) noexcept {
+                return _mm256_castps_si256(_mm256_set1_ps(_Val));
+            }
+
+            static uint32_t _Mask_gt(const __m256i _First, const __m256i _Second) noexcept {
+                return _mm256_movemask_ps(
+                    _mm256_cmp_ps(_mm256_castsi256_ps(_First), _mm256_castsi256_ps(_Second), _CMP_GT_OQ));
+            }
+        };
+
+        struct _Traits_d_sse : _Traits_8_sse {
+            static __m128i _Set(const double _Val) noexcept {
+                return _mm_castpd_si128(_mm_set1_pd(_Val));
+            }
+
+            static uint32_t _Mask_gt(const __m128i _First, const __m128i _Second) noexcept {
+                return _mm_movemask_pd(_mm_cmpgt_pd(_mm_castsi128_pd(_First), _mm_castsi128_pd(_Second)));
+            }
+        };
+
+        struct _Traits_d_avx : _Traits_8_avx {
+            static __m256i _Set(const double _Val) noexcept {
+                return _mm256_castpd_si256(_mm256_set1_pd(_Val));
+            }
+
+            static uint32_t _Mask_gt(const __m256i _First, const __m256i _Second) noexcept {
+                return _mm256_movemask_pd(
+                    _mm256_cmp_pd(_mm256_castsi256_pd(_First), _mm256_castsi256_pd(_Second), _CMP_GT_OQ));
+            }
+        };
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <bool _Greater, class _Ty>
+        bool _Precedes(const _Ty _Left, const _Ty _Right) noexcept {
+            if constexpr (_Greater) {
+                return _Right < _Left;
+            } else {
+                return _Left < _Right;
+            }
+        }
+
+        // The partition functions below move to the left part the elements that satisfy
+        // (_Above ? _Pivot < _Val : _Val < _Pivot) != _Negate, and return the beginning of the right part.
+        // Sorting with less<> uses <false, false> to move the lesser elements to the left, and <true, true> to move
+        // the elements that are not greater than the pivot to the left; greater<> uses the opposite _Above values.
+        template <bool _Above, bool _Negate, class _Ty>
+        bool _Goes_left(const _Ty _Val, const _Ty _Pivot) noexcept {
+            if constexpr (_Above) {
+                return (_Pivot < _Val) != _Negate;
+            } else {
+                return (_Val < _Pivot) != _Negate;
+            }
+        }
+
+        template <bool _Above, bool _Negate, class _Ty>
+        _Ty* _Partition_scalar(_Ty* _First, _Ty* const _Last, const _Ty _Pivot) noexcept {
+            // Branchless Lomuto partition: [_Mid, _First) is the right part seen so far
+            _Ty* _Mid = _First;
+            for (; _First != _Last; ++_First) {
+                const _Ty _Val = *_First;
+                *_First        = *_Mid;
+                *_Mid          = _Val;
+                _Mid += _Goes_left<_Above, _Negate>(_Val, _Pivot);
+            }
+
+            return _Mid;
+        }
+
+#ifndef _M_ARM64EC
+        // Number of vectors the vectorized partition reads from one side at once
+        constexpr size_t _Partition_unroll = 8;
+
+        template <class _Traits, bool _Above, bool _Negate, class _Ty>
+        _Ty* _Partition_vectorized(_Ty* const _First, _Ty* const _Last, const _Ty _Pivot) noexcept {
+            // pre: _Last - _First >= 2 * _Block
+            constexpr size_t _Lanes      = _Traits::_Lanes;
+            constexpr size_t _Block      = _Lanes * _Partition_unroll;
+            constexpr bool _Sign_cor     = static_cast<_Ty>(-1) > _Ty{0};
+            constexpr uint32_t _All_mask = (1u << _Lanes) - 1;
+
+            auto _Pivot_vec = _Traits::_Set(_Pivot);
+            if constexpr (_Sign_cor) {
+                _Pivot_vec = _Traits::_Sign_correction(_Pivot_vec);
+            }
+
+            // Permutes the vector so that its left part comes first, and returns the size of the left part
+            const auto _Split = [_Pivot_vec](typename _Traits::_Vec& _Val) noexcept {
+                auto _Cmp_val = _Val;
+                if constexpr (_Sign_cor) {
+                    _Cmp_val = _Traits::_Sign_correction(_Cmp_val);
+                }
+
+                uint32_t _Bingo;
+                if constexpr (_Above) {
+                    _Bingo = _Traits::_Mask_gt(_Cmp_val, _Pivot_vec);
+                } else {
+                    _Bingo = _Traits::_Mask_gt(_Pivot_vec, _Cmp_val);
+                }
+
+                if constexpr (_Negate) {
+                    _Bingo ^= _All_mask;
+                }
+
+                _Val = _Traits::_Partition(_Val, _Bingo);
+                return static_cast<size_t>(__popcnt(_Bingo)); // Assume available with SSE4.2
+            };
+
+            // The permuted vector is stored twice: its left part is kept in the left output,
+            // and its right part is kept in the right output; the rest of each store is overwritten later.
+            // Both stores must fit in the free room on their sides.
+            _Ty* _Out_first  = _First;
+            _Ty* _Out_last   = _Last;
+            const auto _Step = [&_Out_first, &_Out_last, &_Split](typename _Traits::_Vec _Val) noexcept {
+                const size_t _Left_count = _Split(_Val);
+                _Traits::_Store(_Out_first, _Val);
+                _Traits::_Store(_Out_last - _Lanes, _Val);
+                _Out_first += _Left_count;
+                _Out_last -= _Lanes - _Left_count;
+            };
+
+            // The first and the last blocks are kept aside, this makes room to write the output in place.
+            // Each iteration reads a block from the side which has less room, so that afterwards both sides have
+            // room for a full block. The next read location depends on the previous writes, so the blocks are
+            // large enough to overlap this dependency with useful work.
+            _Ty _Aside[3 * _Block];
+            memcpy(_Aside, _First, _Block * sizeof(_Ty));
+            memcpy(_Aside + _Block, _Last - _Block, _Block * sizeof(_Ty));
+
+            _Ty* _In_first = _First + _Block;
+            _Ty* _In_last  = _Last - _Block;
+
+            while (static_cast<size_t>(_In_last - _In_first) >= _Block) {
+                // The choice of side is unpredictable, so it is made without branches
+                const bool _From_left  = _In_first - _Out_first <= _Out_last - _In_last;
+                const _Ty* const _Src  = _From_left ? _In_first : _In_last - _Block;
+                const size_t _Advance = _From_left ? _Block : 0;
+                _In_first += _Advance;
+                _In_last -= _Block - _Advance;
+
+                typename _Traits::_Vec _Vals[_Partition_unroll];
+                for (size_t _Ix = 0; _Ix != _Partition_unroll; ++_Ix) {
+                    _Vals[_Ix] = _Traits::_Load(_Src + _Ix * _Lanes);
+                }
+
+                for (size_t _Ix = 0; _Ix != _Partition_unroll; ++_Ix) {
+                    _Step(_Vals[_Ix]);
+                }
+            }
+
+            // Fewer than _Block elements are left unread; put them aside too, so that all the rest is free room.
+            // From now on the free room is exactly the number of elements aside.
+            const size_t _Unread = static_cast<size_t>(_In_last - _In_first);
+            memcpy(_Aside + 2 * _Block, _In_first, _Unread * sizeof(_Ty));
+
+            const _Ty* _Aside_ptr       = _Aside;
+            const _Ty* const _Aside_end = _Aside + 2 * _Block + _Unread;
+            for (; static_cast<size_t>(_Aside_end - _Aside_ptr) >= 2 * _Lanes; _Aside_ptr += _Lanes) {
+                _Step(_Traits::_Load(_Aside_ptr));
+            }
+
+            for (; _Aside_ptr != _Aside_end; ++_Aside_ptr) {
+                const _Ty _Val = *_Aside_ptr;
+                if (_Goes_left<_Above, _Negate>(_Val, _Pivot)) {
+                    *_Out_first = _Val;
+                    ++_Out_first;
+                } else {
+                    --_Out_last;
+                    *_Out_last = _Val;
+                }
+            }
+
+            return _Out_first;
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <class _Traits, bool _Above, bool _Negate, class _Ty>
+        _Ty* _Partition(_Ty* const _First, _Ty* const _Last, const _Ty _Pivot) noexcept {
+            if constexpr (!std::is_void_v<_Traits>) {
+#ifdef _M_ARM64EC
+                static_assert(false, "No vectorization for _M_ARM64EC yet");
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+                if (static_cast<size_t>(_Last - _First) >= 2 * _Traits::_Lanes * _Partition_unroll) {
+                    return _Partition_vectorized<_Traits, _Above, _Negate>(_First, _Last, _Pivot);
+                }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            }
+
+            return _Partition_scalar<_Above, _Negate>(_First, _Last, _Pivot);
+        }
+
+        template <bool _Greater, class _Ty>
+        void _Compare_exchange(_Ty& _Left, _Ty& _Right) noexcept {
+            // Conditional moves rather than branches, as the outcome is unpredictable
+            const bool _Swap  = _Precedes<_Greater>(_Right, _Left);
+            const _Ty _First  = _Swap ? _Right : _Left;
+            const _Ty _Second = _Swap ? _Left : _Right;
+            _Left             = _First;
+            _Right            = _Second;
+        }
+
+        // Optimal sorting networks (minimal number of comparators) for 8 and 16 elements
+        constexpr uint8_t _Network_8[][2] = {{0, 2}, {1, 3}, {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {0, 1},
+            {2, 3}, {4, 5}, {6, 7}, {2, 4}, {3, 5}, {1, 4}, {3, 6}, {1, 2}, {3, 4}, {5, 6}};
+
+        constexpr uint8_t _Network_16[][2] = {{0, 13}, {1, 12}, {2, 15}, {3, 14}, {4, 8}, {5, 6}, {7, 11}, {9, 10},
+            {0, 5}, {1, 7}, {2, 9}, {3, 4}, {6, 13}, {8, 14}, {10, 15}, {11, 12}, {0, 1}, {2, 3}, {4, 5}, {6, 8},
+            {7, 9}, {10, 11}, {12, 13}, {14, 15}, {0, 2}, {1, 3}, {4, 10}, {5, 11}, {6, 7}, {8, 9}, {12, 14},
+            {13, 15}, {1, 2}, {3, 12}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {13, 14}, {1, 4}, {2, 6}, {5, 8}, {7, 10},
+            {9, 13}, {11, 14}, {2, 4}, {3, 6}, {9, 12}, {11, 13}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {3, 4}, {5, 6},
+            {7, 8}, {9, 10}, {11, 12}, {6, 7}, {8, 9}};
+
+        template <bool _Greater, class _Ty>
+        constexpr _Ty _Leaf_padding() noexcept {
+            // No element precedes the padding, so it stays after the elements being sorted.
+            // It has a unique representation, so copying the first elements back preserves the original values.
+            using _Limits = std::numeric_limits<_Ty>;
+            if constexpr (_Limits::has_infinity) {
+                return _Greater ? -_Limits::infinity() : _Limits::infinity();
+            } else {
+                return _Greater ? (_Limits::min)() : (_Limits::max)();
+            }
+        }
+
+        template <bool _Greater, size_t _Width, size_t _Size, class _Ty>
+        void _Sort_network(_Ty* const _First, const size_t _Count, const uint8_t (&_Network)[_Size][2]) noexcept {
+            // pre: _Count <= _Width
+            _Ty _Buf[_Width];
+            memcpy(_Buf, _First, _Count * sizeof(_Ty));
+            for (size_t _Ix = _Count; _Ix != _Width; ++_Ix) {
+                _Buf[_Ix] = _Leaf_padding<_Greater, _Ty>();
+            }
+
+            for (const auto& _Comparator : _Network) {
+                _Compare_exchange<_Greater>(_Buf[_Comparator[0]], _Buf[_Comparator[1]]);
+            }
+
+            memcpy(_First, _Buf, _Count * sizeof(_Ty));
+        }
+
+        template <bool _Greater, class _Ty>
+        void _Sort_leaf(_Ty* const _First, const size_t _Count) noexcept {
+            // pre: _Count <= _Leaf_max
+            if (_Count <= 1) {
+                return;
+            } else if (_Count <= 8) {
+                _Sort_network<_Greater, 8>(_First, _Count, _Network_8);
+            } else {
+                _Sort_network<_Greater, 16>(_First, _Count, _Network_16);
+            }
+        }
+
+        template <bool _Greater, class _Ty>
+        _Ty _Median_of_3(const _Ty _Val1, const _Ty _Val2, const _Ty _Val3) noexcept {
+            const bool _Cmp_12 = _Precedes<_Greater>(_Val1, _Val2);
+            const bool _Cmp_23 = _Precedes<_Greater>(_Val2, _Val3);
+            const bool _Cmp_13 = _Precedes<_Greater>(_Val1, _Val3);
+            if (_Cmp_12 == _Cmp_23) {
+                return _Val2;
+            } else if (_Cmp_12 == _Cmp_13) {
+                return _Val3;
+            } else {
+                return _Val1;
+            }
+        }
+
+        template <bool _Greater, class _Ty>
+        _Ty _Choose_pivot(const _Ty* const _First, const size_t _Count) noexcept {
+            // Pick the pivot value without moving elements
+            const _Ty* const _Mid  = _First + (_Count >> 1);
+            const _Ty* const _Back = _First + (_Count - 1);
+            if (_Count > 128) { // Tukey's ninther
+                const size_t _Step     = _Count >> 3;
+                const size_t _Two_step = _Step << 1;
+                return _Median_of_3<_Greater>(
+                    _Median_of_3<_Greater>(_First[0], _First[_Step], _First[_Two_step]),
+                    _Median_of_3<_Greater>(*(_Mid - _Step), *_Mid, *(_Mid + _Step)),
+                    _Median_of_3<_Greater>(*(_Back - _Two_step), *(_Back - _Step), *_Back));
+            }
+
+            return _Median_of_3<_Greater>(*_First, *_Mid, *_Back);
+        }
+
+        template <bool _Greater, class _Ty>
+        void _Heap_sort(_Ty* const _First, const size_t _Count) noexcept {
+            const auto _Sift_down = [_First](size_t _Hole, const size_t _Bottom, const _Ty _Val) noexcept {
+                for (;;) {
+                    size_t _Child = 2 * _Hole + 1;
+                    if (_Child >= _Bottom) {
+                        break;
+                    }
+
+                    if (_Child + 1 < _Bottom && _Precedes<_Greater>(_First[_Child], _First[_Child + 1])) {
+                        ++_Child;
+                    }
+
+                    if (!_Precedes<_Greater>(_Val, _First[_Child])) {
+                        break;
+                    }
+
+                    _First[_Hole] = _First[_Child];
+                    _Hole         = _Child;
+                }
+
+                _First[_Hole] = _Val;
+            };
+
+            for (size_t _Ix = _Count >> 1; _Ix != 0;) {
+                --_Ix;
+                _Sift_down(_Ix, _Count, _First[_Ix]);
+            }
+
+            for (size_t _Bottom = _Count; _Bottom > 1;) {
+                --_Bottom;
+                const _Ty _Val  = _First[_Bottom];
+                _First[_Bottom] = _First[0];
+                _Sift_down(0, _Bottom, _Val);
+            }
+        }
+
+        template <class _Traits, bool _Greater, class _Ty>
+        void _Sort_impl(_Ty* _First, _Ty* _Last, ptrdiff_t _Ideal) noexcept {
+            for (;;) {
+                const size_t _Count = static_cast<size_t>(_Last - _First);
+                if (_Count <= _Leaf_max) {
+                    _Sort_leaf<_Greater>(_First, _Count);
+                    return;
+                }
+
+                if (_Ideal <= 0) { // heap sort if too many divisions
+                    _Heap_sort<_Greater>(_First, _Count);
+                    return;
+                }
+
+                _Ideal = (_Ideal >> 1) + (_Ideal >> 2); // allow 1.5 log2(N) divisions
+
+                const _Ty _Pivot = _Choose_pivot<_Greater>(_First, _Count);
+                _Ty* const _Mid  = _Partition<_Traits, _Greater, false>(_First, _Last, _Pivot);
+
+                if (_Mid == _First) {
+                    // Nothing precedes the pivot, so the elements equivalent to it go first.
+                    // Move them to the front and skip them; this always skips at least the pivot itself.
+                    _First = _Partition<_Traits, !_Greater, true>(_First, _Last, _Pivot);
+                    continue;
+                }
+
+                if (_Mid - _First < _Last - _Mid) { // loop on second half
+                    _Sort_impl<_Traits, _Greater>(_First, _Mid, _Ideal);
+                    _First = _Mid;
+                } else { // loop on first half
+                    _Sort_impl<_Traits, _Greater>(_Mid, _Last, _Ideal);
+                    _Last = _Mid;
+                }
+            }
+        }
+
+        template <class _Traits, class _Ty>
+        void _Sort_top(void* const _First, void* const _Last, const bool _Greater) noexcept {
+            const auto _First_ptr = static_cast<_Ty*>(_First);
+            const auto _Last_ptr  = static_cast<_Ty*>(_Last);
+            if (_Greater) {
+                _Sort_impl<_Traits, true>(_First_ptr, _Last_ptr, _Last_ptr - _First_ptr);
+            } else {
+                _Sort_impl<_Traits, false>(_First_ptr, _Last_ptr, _Last_ptr - _First_ptr);
+            }
+        }
+
+        template <class _Traits_avx, class _Traits_sse, class _Ty>
+        void __stdcall _Sort_disp(void* const _First, void* const _Last, const bool _Greater) noexcept {
+#ifndef _M_ARM64EC
+            if constexpr (!std::is_void_v<_Traits_avx>) {
+                if (_Byte_length(_First, _Last) > _Leaf_max * sizeof(_Ty) && _Use_avx2()) {
+                    [[maybe_unused]] typename _Traits_avx::_Guard _Guard; // TRANSITION, DevCom-10331414
+                    _Sort_top<_Traits_avx, _Ty>(_First, _Last, _Greater);
+                    return;
+                }
+            }
+
+            if (_Byte_length(_First, _Last) > _Leaf_max * sizeof(_Ty) && _Use_sse42()) {
+                _Sort_top<_Traits_sse, _Ty>(_First, _Last, _Greater);
+                return;
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            _Sort_top<void, _Ty>(_First, _Last, _Greater);
+        }
+
+        template <bool _Greater, class _Ty>
+        _Ty _Median_of_medians(_Ty* const _First, const size_t _Count) noexcept;
+
+        template <class _Traits, bool _Greater, class _Ty>
+        void _Nth_impl(_Ty* _First, _Ty* const _Nth, _Ty* _Last) noexcept {
+            ptrdiff_t _Ideal = _Last - _First;
+            bool _Guaranteed = false;
+            for (;;) {
+                const size_t _Count = static_cast<size_t>(_Last - _First);
+                if (_Count <= _Leaf_max) {
+                    _Sort_leaf<_Greater>(_First, _Count);
+                    return;
+                }
+
+                if (_Ideal < static_cast<ptrdiff_t>(_Count >> 1)) {
+                    // Too little progress was made; switch to median of medians pivots to guarantee linear time
+                    _Guaranteed = true;
+                }
+
+                _Ideal = (_Ideal >> 1) + (_Ideal >> 2); // processed range should shrink by 25% per iteration
+
+                const _Ty _Pivot = _Guaranteed ? _Median_of_medians<_Greater>(_First, _Count)
+                                               : _Choose_pivot<_Greater>(_First, _Count);
+                _Ty* const _Mid  = _Partition<_Traits, _Greater, false>(_First, _Last, _Pivot);
+
+                if (_Nth < _Mid) {
+                    _Last = _Mid;
+                } else if (_Mid != _First) {
+                    _First = _Mid;
+                } else {
+                    // Nothing precedes the pivot, so the elements equivalent to it go first.
+                    // This is the middle part of a three-way partition, only needed when it is not empty.
+                    _Ty* const _Equal_last = _Partition<_Traits, !_Greater, true>(_First, _Last, _Pivot);
+                    if (_Nth < _Equal_last) {
+                        return;
+                    }
+
+                    _First = _Equal_last;
+                }
+            }
+        }
+
+        template <bool _Greater, class _Ty>
+        _Ty _Median_of_medians(_Ty* const _First, const size_t _Count) noexcept {
+            // pre: _Count > _Leaf_max
+            // Collect the medians of groups of five at the front, then select their median, without vectorization,
+            // as the groups are too small to benefit from it
+            const size_t _Median_count = _Count / 5;
+            _Ty* _Group                = _First;
+            for (size_t _Ix = 0; _Ix != _Median_count; ++_Ix, _Group += 5) {
+                // Sorting network for 5 elements
+                _Compare_exchange<_Greater>(_Group[0], _Group[1]);
+                _Compare_exchange<_Greater>(_Group[3], _Group[4]);
+                _Compare_exchange<_Greater>(_Group[2], _Group[4]);
+                _Compare_exchange<_Greater>(_Group[2], _Group[3]);
+                _Compare_exchange<_Greater>(_Group[0], _Group[3]);
+                _Compare_exchange<_Greater>(_Group[0], _Group[2]);
+                _Compare_exchange<_Greater>(_Group[1], _Group[4]);
+                _Compare_exchange<_Greater>(_Group[1], _Group[3]);
+                _Compare_exchange<_Greater>(_Group[1], _Group[2]);
+
+                const _Ty _Median = _Group[2];
+                _Group[2]         = _First[_Ix];
+                _First[_Ix]       = _Median;
+            }
+
+            _Ty* const _Median_mid = _First + (_Median_count >> 1);
+            _Nth_impl<void, _Greater>(_First, _Median_mid, _First + _Median_count);
+            return *_Median_mid;
+        }
+
+        template <class _Traits, class _Ty>
+        void _Nth_top(void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+            const auto _First_ptr = static_cast<_Ty*>(_First);
+            const auto _Nth_ptr   = static_cast<_Ty*>(_Nth);
+            const auto _Last_ptr  = static_cast<_Ty*>(_Last);
+            if (_Greater) {
+                _Nth_impl<_Traits, true>(_First_ptr, _Nth_ptr, _Last_ptr);
+            } else {
+                _Nth_impl<_Traits, false>(_First_ptr, _Nth_ptr, _Last_ptr);
+            }
+        }
+
+        template <class _Traits_avx, class _Traits_sse, class _Ty>
+        void __stdcall _Nth_disp(
+            void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+#ifndef _M_ARM64EC
+            if constexpr (!std::is_void_v<_Traits_avx>) {
+                if (_Byte_length(_First, _Last) > _Leaf_max * sizeof(_Ty) && _Use_avx2()) {
+                    [[maybe_unused]] typename _Traits_avx::_Guard _Guard; // TRANSITION, DevCom-10331414
+                    _Nth_top<_Traits_avx, _Ty>(_First, _Nth, _Last, _Greater);
+                    return;
+                }
+            }
+
+            if (_Byte_length(_First, _Last) > _Leaf_max * sizeof(_Ty) && _Use_sse42()) {
+                _Nth_top<_Traits_sse, _Ty>(_First, _Nth, _Last, _Greater);
+                return;
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            _Nth_top<void, _Ty>(_First, _Nth, _Last, _Greater);
+        }
+    } // namespace _Partitioning
+
+    namespace _Counting_sort {
+        // Byte ranges at least this long are sorted by counting the occurrences of each value.
+        constexpr size_t _Threshold_1 = 256;
+        // 2-byte element ranges at least this long are sorted by an in-place radix sort on the high byte
+        // followed by counting sort (or by the comparison sort for small buckets) on the low byte.
+        constexpr size_t _Threshold_2 = 2048;
+
+        template <class _Ty>
+        auto _Key_mask(const bool _Greater) noexcept {
+            // XOR-ing an element with the mask gives an unsigned key whose ascending order is the requested order.
+            // The mapping is an involution, so the same mask also turns keys back into elements.
+            using _Key          = std::conditional_t<sizeof(_Ty) == 1, uint8_t, uint16_t>;
+            constexpr _Key _Top = static_cast<_Key>(_Key{1} << (sizeof(_Ty) * 8 - 1));
+            const _Key _Mask    = std::is_signed_v<_Ty> ? _Top : _Key{0};
+            return static_cast<_Key>(_Greater ? ~_Mask : _Mask);
+        }
+
+        template <unsigned int _Shift, class _Elem>
+        void _Histogram(const _Elem* _First, const _Elem* const _Last, size_t (&_Counts)[256]) noexcept {
+            // Separate tables for interleaved elements avoid store-to-load stalls on runs of the same value
+            size_t _Partial[4][256] = {};
+            for (; _Last - _First >= 4; _First += 4) {
+                ++_Partial[0][static_cast<uint8_t>(_First[0] >> _Shift)];
+                ++_Partial[1][static_cast<uint8_t>(_First[1] >> _Shift)];
+                ++_Partial[2][static_cast<uint8_t>(_First[2] >> _Shift)];
+                ++_Partial[3][static_cast<uint8_t>(_First[3] >> _Shift)];
+            }
+
+            for (; _First != _Last; ++_First) {
+                ++_Partial[0][static_cast<uint8_t>(*_First >> _Shift)];
+            }
+
+            for (size_t _Ix = 0; _Ix != 256; ++_Ix) {
+                _Counts[_Ix] = _Partial[0][_Ix] + _Partial[1][_Ix] + _Partial[2][_Ix] + _Partial[3][_Ix];
+            }
+        }
+
+        template <class _Ty>
+        void _Sort_1(void* const _First, void* const _Last, const bool _Greater) noexcept {
+            auto _Dest = static_cast<uint8_t*>(_First);
+            size_t _Counts[256];
+            _Histogram<0>(_Dest, static_cast<const uint8_t*>(_Last), _Counts);
+
+            const uint8_t _Mask = _Key_mask<_Ty>(_Greater);
+            for (size_t _Key = 0; _Key != 256; ++_Key) {
+                const uint8_t _Val  = static_cast<uint8_t>(_Key ^ _Mask);
+                const size_t _Count = _Counts[_Val];
+                memset(_Dest, _Val, _Count);
+                _Dest += _Count;
+            }
+        }
+
+        template <class _Ty>
+        void _Sort_2(void* const _First, void* const _Last, const bool _Greater) noexcept {
+            const auto _First_ptr  = static_cast<uint16_t*>(_First);
+            const auto _Last_ptr   = static_cast<uint16_t*>(_Last);
+            const uint16_t _Mask   = _Key_mask<_Ty>(_Greater);
+            const uint8_t _Mask_hi = static_cast<uint8_t>(_Mask >> 8);
+            const uint8_t _Mask_lo = static_cast<uint8_t>(_Mask);
+
+            size_t _Counts[256];
+            _Histogram<8>(_First_ptr, _Last_ptr, _Counts);
+
+            // _Heads and _Tails are indexed by the high byte of the key
+            size_t _Heads[256];
+            size_t _Tails[256];
+            size_t _Pos = 0;
+            for (size_t _Key = 0; _Key != 256; ++_Key) {
+                _Heads[_Key] = _Pos;
+                _Pos += _Counts[_Key ^ _Mask_hi];
+                _Tails[_Key] = _Pos;
+            }
+
+            // Move each element to its bucket in place by following permutation cycles (American flag sort)
+            for (size_t _Bucket = 0; _Bucket != 256; ++_Bucket) {
+                while (_Heads[_Bucket] != _Tails[_Bucket]) {
+                    uint16_t _Val = _First_ptr[_Heads[_Bucket]];
+                    for (;;) {
+                        const size_t _Dest = static_cast<uint8_t>(_Val >> 8) ^ _Mask_hi;
+                        if (_Dest == _Bucket) {
+                            break;
+                        }
+
+                        const uint16_t _Displaced   = _First_ptr[_Heads[_Dest]];
+                        _First_ptr[_Heads[_Dest]++] = _Val;
+                        _Val                        = _Displaced;
+                    }
+
+                    _First_ptr[_Heads[_Bucket]++] = _Val;
+                }
+            }
+
+            // All elements of a bucket share the high byte; order each bucket by the low byte
+            uint16_t* _Bucket_first = _First_ptr;
+            for (size_t _Bucket = 0; _Bucket != 256; ++_Bucket) {
+                const uint8_t _Hi            = static_cast<uint8_t>(_Bucket ^ _Mask_hi);
+                const size_t _Size           = _Counts[_Hi];
+                uint16_t* const _Bucket_last = _Bucket_first + _Size;
+                if (_Size >= _Threshold_1) {
+                    size_t _Low_counts[256];
+                    _Histogram<0>(_Bucket_first, _Bucket_last, _Low_counts);
+
+                    uint16_t* _Dest = _Bucket_first;
+                    for (size_t _Key = 0; _Key != 256; ++_Key) {
+                        const uint8_t _Lo         = static_cast<uint8_t>(_Key ^ _Mask_lo);
+                        const uint16_t _Val       = static_cast<uint16_t>((_Hi << 8) | _Lo);
+                        uint16_t* const _Run_last = _Dest + _Low_counts[_Lo];
+                        for (; _Dest != _Run_last; ++_Dest) {
+                            *_Dest = _Val;
+                        }
+                    }
+                } else if (_Size > 1) {
+                    _Partitioning::_Sort_disp<void, _Partitioning::_Traits_2_sse, _Ty>(
+                        _Bucket_first, _Bucket_last, _Greater);
+                }
+
+                _Bucket_first = _Bucket_last;
+            }
+        }
+    } // namespace _Counting_sort
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) void __stdcall __std_sort_1i(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    if (_Byte_length(_First, _Last) >= _Counting_sort::_Threshold_1) {
+        _Counting_sort::_Sort_1<int8_t>(_First, _Last, _Greater);
+    } else {
+        _Partitioning::_Sort_disp<void, _Partitioning::_Traits_1_sse, int8_t>(_First, _Last, _Greater);
+    }
+}
+
+__declspec(noalias) void __stdcall __std_sort_1u(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    if (_Byte_length(_First, _Last) >= _Counting_sort::_Threshold_1) {
+        _Counting_sort::_Sort_1<uint8_t>(_First, _Last, _Greater);
+    } else {
+        _Partitioning::_Sort_disp<void, _Partitioning::_Traits_1_sse, uint8_t>(_First, _Last, _Greater);
+    }
+}
+
+__declspec(noalias) void __stdcall __std_sort_2i(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    if (_Byte_length(_First, _Last) >= _Counting_sort::_Threshold_2 * sizeof(int16_t)) {
+        _Counting_sort::_Sort_2<int16_t>(_First, _Last, _Greater);
+    } else {
+        _Partitioning::_Sort_disp<void, _Partitioning::_Traits_2_sse, int16_t>(_First, _Last, _Greater);
+    }
+}
+
+__declspec(noalias) void __stdcall __std_sort_2u(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    if (_Byte_length(_First, _Last) >= _Counting_sort::_Threshold_2 * sizeof(uint16_t)) {
+        _Counting_sort::_Sort_2<uint16_t>(_First, _Last, _Greater);
+    } else {
+        _Partitioning::_Sort_disp<void, _Partitioning::_Traits_2_sse, uint16_t>(_First, _Last, _Greater);
+    }
+}
+
+__declspec(noalias) void __stdcall __std_sort_4i(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Sort_disp<_Partitioning::_Traits_4_avx, _Partitioning::_Traits_4_sse, int32_t>(
+        _First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_4u(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Sort_disp<_Partitioning::_Traits_4_avx, _Partitioning::_Traits_4_sse, uint32_t>(
+        _First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_8i(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Sort_disp<_Partitioning::_Traits_8_avx, _Partitioning::_Traits_8_sse, int64_t>(
+        _First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_8u(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Sort_disp<_Partitioning::_Traits_8_avx, _Partitioning::_Traits_8_sse, uint64_t>(
+        _First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_f(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Sort_disp<_Partitioning::_Traits_f_avx, _Partitioning::_Traits_f_sse, float>(
+        _First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_sort_d(void* const _First, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Sort_disp<_Partitioning::_Traits_d_avx, _Partitioning::_Traits_d_sse, double>(
+        _First, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_1i(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Nth_disp<void, _Partitioning::_Traits_1_sse, int8_t>(_First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_1u(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Nth_disp<void, _Partitioning::_Traits_1_sse, uint8_t>(_First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_2i(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Nth_disp<void, _Partitioning::_Traits_2_sse, int16_t>(_First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_2u(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Nth_disp<void, _Partitioning::_Traits_2_sse, uint16_t>(_First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_4i(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Nth_disp<_Partitioning::_Traits_4_avx, _Partitioning::_Traits_4_sse, int32_t>(
+        _First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_4u(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Nth_disp<_Partitioning::_Traits_4_avx, _Partitioning::_Traits_4_sse, uint32_t>(
+        _First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_8i(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Nth_disp<_Partitioning::_Traits_8_avx, _Partitioning::_Traits_8_sse, int64_t>(
+        _First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_8u(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Nth_disp<_Partitioning::_Traits_8_avx, _Partitioning::_Traits_8_sse, uint64_t>(
+        _First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_f(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Nth_disp<_Partitioning::_Traits_f_avx, _Partitioning::_Traits_f_sse, float>(
+        _First, _Nth, _Last, _Greater);
+}
+
+__declspec(noalias) void __stdcall __std_nth_element_d(
+    void* const _First, void* const _Nth, void* const _Last, const bool _Greater) noexcept {
+    _Partitioning::_Nth_disp<_Partitioning::_Traits_d_avx, _Partitioning::_Traits_d_sse, double>(
+        _First, _Nth, _Last, _Greater);
+}
+
+} // extern "C"
+
+namespace {
+    namespace _Sorted_search {
+        // The branchless binary search narrows the range down to this many bytes (a few cache lines),
+        // then the elements that precede the answer are counted with SIMD
+        constexpr size_t _Scan_bytes = 128;
+
+        template <class _Traits, bool _Upper, class _Ty>
+        const _Ty* _Bound_impl(const _Ty* _First, size_t _Count, const _Ty _Val) noexcept {
+            // lower_bound skips the elements that satisfy _Elem < _Val, upper_bound skips those with !(_Val < _Elem)
+            constexpr size_t _Scan_max = std::is_void_v<_Traits> ? 1 : _Scan_bytes / sizeof(_Ty);
+
+            // The answer is always within [_First, _First + _Count]
+            while (_Count > _Scan_max) {
+                const size_t _Half      = _Count >> 1;
+                const size_t _Next_half = (_Count - _Half) >> 1;
+#ifndef _M_ARM64EC
+                // Both possible next midpoints; one of them is fetched in vain, but the other is no longer a stall
+                _mm_prefetch(reinterpret_cast<const char*>(_First + _Next_half), _MM_HINT_T0);
+                _mm_prefetch(reinterpret_cast<const char*>(_First + _Half + _Next_half), _MM_HINT_T0);
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+                _First += _Partitioning::_Goes_left<_Upper, _Upper>(_First[_Half], _Val) ? _Half : 0;
+                _Count -= _Half;
+            }
+
+            size_t _Skipped = 0;
+            size_t _Ix      = 0;
+            if constexpr (!std::is_void_v<_Traits>) {
+#ifdef _M_ARM64EC
+                static_assert(false, "No vectorization for _M_ARM64EC yet");
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+                constexpr size_t _Lanes      = _Traits::_Lanes;
+                constexpr bool _Sign_cor     = static_cast<_Ty>(-1) > _Ty{0};
+                constexpr uint32_t _All_mask = (1u << _Lanes) - 1;
+
+                auto _Val_vec = _Traits::_Set(_Val);
+                if constexpr (_Sign_cor) {
+                    _Val_vec = _Traits::_Sign_correction(_Val_vec);
+                }
+
+                for (; _Count - _Ix >= _Lanes; _Ix += _Lanes) {
+                    auto _Data = _Traits::_Load(_First + _Ix);
+                    if constexpr (_Sign_cor) {
+                        _Data = _Traits::_Sign_correction(_Data);
+                    }
+
+                    uint32_t _Bingo;
+                    if constexpr (_Upper) {
+                        _Bingo = _Traits::_Mask_gt(_Data, _Val_vec) ^ _All_mask;
+                    } else {
+                        _Bingo = _Traits::_Mask_gt(_Val_vec, _Data);
+                    }
+
+                    _Skipped += __popcnt(_Bingo); // Assume available with SSE4.2
+                }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            }
+
+            for (; _Ix != _Count; ++_Ix) {
+                _Skipped += _Partitioning::_Goes_left<_Upper, _Upper>(_First[_Ix], _Val);
+            }
+
+            return _First + _Skipped;
+        }
+
+        template <class _Traits_avx, class _Traits_sse, bool _Upper, class _Ty>
+        const void* __stdcall _Bound_disp(const void* const _First, const void* const _Last, const _Ty _Val) noexcept {
+            const auto _First_ptr = static_cast<const _Ty*>(_First);
+            const size_t _Count   = _Byte_length(_First, _Last) / sizeof(_Ty);
+#ifndef _M_ARM64EC
+            if constexpr (!std::is_void_v<_Traits_avx>) {
+                if (_Use_avx2()) {
+                    [[maybe_unused]] typename _Traits_avx::_Guard _Guard; // TRANSITION, DevCom-10331414
+                    return _Bound_impl<_Traits_avx, _Upper>(_First_ptr, _Count, _Val);
+                }
+            }
+
+            if (_Use_sse42()) {
+                return _Bound_impl<_Traits_sse, _Upper>(_First_ptr, _Count, _Val);
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            return _Bound_impl<void, _Upper>(_First_ptr, _Count, _Val);
+        }
+    } // namespace _Sorted_search
+} // unnamed namespace
+
+extern "C" {
+
+const void* __stdcall __std_lower_bound_1i(
+    const void* const _First, const void* const _Last, const int8_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<void, _Partitioning::_Traits_1_sse, false>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_1u(
+    const void* const _First, const void* const _Last, const uint8_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<void, _Partitioning::_Traits_1_sse, false>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_2i(
+    const void* const _First, const void* const _Last, const int16_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<void, _Partitioning::_Traits_2_sse, false>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_2u(
+    const void* const _First, const void* const _Last, const uint16_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<void, _Partitioning::_Traits_2_sse, false>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_4i(
+    const void* const _First, const void* const _Last, const int32_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<_Partitioning::_Traits_4_avx, _Partitioning::_Traits_4_sse, false>(
+        _First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_4u(
+    const void* const _First, const void* const _Last, const uint32_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<_Partitioning::_Traits_4_avx, _Partitioning::_Traits_4_sse, false>(
+        _First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_8i(
+    const void* const _First, const void* const _Last, const int64_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<_Partitioning::_Traits_8_avx, _Partitioning::_Traits_8_sse, false>(
+        _First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_8u(
+    const void* const _First, const void* const _Last, const uint64_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<_Partitioning::_Traits_8_avx, _Partitioning::_Traits_8_sse, false>(
+        _First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_f(
+    const void* const _First, const void* const _Last, const float _Val) noexcept {
+    return _Sorted_search::_Bound_disp<_Partitioning::_Traits_f_avx, _Partitioning::_Traits_f_sse, false>(
+        _First, _Last, _Val);
+}
+
+const void* __stdcall __std_lower_bound_d(
+    const void* const _First, const void* const _Last, const double _Val) noexcept {
+    return _Sorted_search::_Bound_disp<_Partitioning::_Traits_d_avx, _Partitioning::_Traits_d_sse, false>(
+        _First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_1i(
+    const void* const _First, const void* const _Last, const int8_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<void, _Partitioning::_Traits_1_sse, true>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_1u(
+    const void* const _First, const void* const _Last, const uint8_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<void, _Partitioning::_Traits_1_sse, true>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_2i(
+    const void* const _First, const void* const _Last, const int16_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<void, _Partitioning::_Traits_2_sse, true>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_2u(
+    const void* const _First, const void* const _Last, const uint16_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<void, _Partitioning::_Traits_2_sse, true>(_First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_4i(
+    const void* const _First, const void* const _Last, const int32_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<_Partitioning::_Traits_4_avx, _Partitioning::_Traits_4_sse, true>(
+        _First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_4u(
+    const void* const _First, const void* const _Last, const uint32_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<_Partitioning::_Traits_4_avx, _Partitioning::_Traits_4_sse, true>(
+        _First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_8i(
+    const void* const _First, const void* const _Last, const int64_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<_Partitioning::_Traits_8_avx, _Partitioning::_Traits_8_sse, true>(
+        _First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_8u(
+    const void* const _First, const void* const _Last, const uint64_t _Val) noexcept {
+    return _Sorted_search::_Bound_disp<_Partitioning::_Traits_8_avx, _Partitioning::_Traits_8_sse, true>(
+        _First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_f(
+    const void* const _First, const void* const _Last, const float _Val) noexcept {
+    return _Sorted_search::_Bound_disp<_Partitioning::_Traits_f_avx, _Partitioning::_Traits_f_sse, true>(
+        _First, _Last, _Val);
+}
+
+const void* __stdcall __std_upper_bound_d(
+    const void* const _First, const void* const _Last, const double _Val) noexcept {
+    return _Sorted_search::_Bound_disp<_Partitioning::_Traits_d_avx, _Partitioning::_Traits_d_sse, true>(
+        _First, _Last, _Val);
+}
+
+} // extern "C"
+
+namespace {
+    namespace _Set_operations {
+        // The SIMD loops of set_intersection and set_difference collect the output here, so that they can store
+        // whole vectors without knowing how much room the destination has
+        constexpr size_t _Stage_bytes = 1024;
+
+        enum class _Set_op { _Merge, _Union, _Intersection, _Difference };
+
+#ifdef _M_ARM64EC
+        using _Traits_4_avx = void;
+        using _Traits_4_sse = void;
+        using _Traits_8_avx = void;
+        using _Traits_8_sse = void;
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+        struct _Traits_4_sse : _Partitioning::_Traits_4_sse {
+            static uint32_t _Mask_eq(const __m128i _First, const __m128i _Second) noexcept {
+                return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_First, _Second)));
+            }
+
+            static uint32_t _Mask_match(const __m128i _First, const __m128i _Second) noexcept {
+                // Compares against each rotation of _Second, so every pair of elements is compared once
+                const __m128i _Eq0 = _mm_cmpeq_epi32(_First, _Second);
+                const __m128i _Eq1 = _mm_cmpeq_epi32(_First, _mm_shuffle_epi32(_Second, _MM_SHUFFLE(0, 3, 2, 1)));
+                const __m128i _Eq2 = _mm_cmpeq_epi32(_First, _mm_shuffle_epi32(_Second, _MM_SHUFFLE(1, 0, 3, 2)));
+                const __m128i _Eq3 = _mm_cmpeq_epi32(_First, _mm_shuffle_epi32(_Second, _MM_SHUFFLE(2, 1, 0, 3)));
+                const __m128i _Eq  = _mm_or_si128(_mm_or_si128(_Eq0, _Eq1), _mm_or_si128(_Eq2, _Eq3));
+                return _mm_movemask_ps(_mm_castsi128_ps(_Eq));
+            }
+
+            static __m128i _Min(const __m128i _First, const __m128i _Second) noexcept {
+                return _mm_min_epi32(_First, _Second);
+            }
+
+            static __m128i _Max(const __m128i _First, const __m128i _Second) noexcept {
+                return _mm_max_epi32(_First, _Second);
+            }
+
+            static __m128i _Reverse(const __m128i _Val) noexcept {
+                return _mm_shuffle_epi32(_Val, _MM_SHUFFLE(0, 1, 2, 3));
+            }
+
+            static __m128i _Sort_bitonic(__m128i _Val) noexcept {
+                __m128i _Swapped = _mm_shuffle_epi32(_Val, _MM_SHUFFLE(1, 0, 3, 2));
+                _Val             = _mm_blend_epi16(_Min(_Val, _Swapped), _Max(_Val, _Swapped), 0xF0);
+                _Swapped         = _mm_shuffle_epi32(_Val, _MM_SHUFFLE(2, 3, 0, 1));
+                return _mm_blend_epi16(_Min(_Val, _Swapped), _Max(_Val, _Swapped), 0xCC);
+            }
+
+            static __m128i _Shift_in(const __m128i _Prev, const __m128i _Val) noexcept {
+                // The last element of _Prev followed by all but the last element of _Val
+                return _mm_alignr_epi8(_Val, _Prev, 12);
+            }
+        };
+
+        struct _Traits_4_avx : _Partitioning::_Traits_4_avx {
+            static uint32_t _Mask_eq(const __m256i _First, const __m256i _Second) noexcept {
+                return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_First, _Second)));
+            }
+
+            static uint32_t _Mask_match(const __m256i _First, const __m256i _Second) noexcept {
+                // The rotations within each half of _Second and of its swapped halves make all 8 rotations
+                const __m256i _Swapped = _mm256_permute2x128_si256(_Second, _Second, 0x01);
+                const __m256i _Eq0     = _mm256_or_si256(
+                    _mm256_cmpeq_epi32(_First, _Second), _mm256_cmpeq_epi32(_First, _Swapped));
+                const __m256i _Eq1 = _mm256_or_si256(
+                    _mm256_cmpeq_epi32(_First, _mm256_shuffle_epi32(_Second, _MM_SHUFFLE(0, 3, 2, 1))),
+                    _mm256_cmpeq_epi32(_First, _mm256_shuffle_epi32(_Swapped, _MM_SHUFFLE(0, 3, 2, 1))));
+                const __m256i _Eq2 = _mm256_or_si256(
+                    _mm256_cmpeq_epi32(_First, _mm256_shuffle_epi32(_Second, _MM_SHUFFLE(1, 0, 3, 2))),
+                    _mm256_cmpeq_epi32(_First, _mm256_shuffle_epi32(_Swapped, _MM_SHUFFLE(1, 0, 3, 2))));
+                const __m256i _Eq3 = _mm256_or_si256(
+                    _mm256_cmpeq_epi32(_First, _mm256_shuffle_epi32(_Second, _MM_SHUFFLE(2, 1, 0, 3))),
+                    _mm256_cmpeq_epi32(_First, _mm256_shuffle_epi32(_Swapped, _MM_SHUFFLE(2, 1, 0, 3))));
+                const __m256i _Eq = _mm256_or_si256(_mm256_or_si256(_Eq0, _Eq1), _mm256_or_si256(_Eq2, _Eq3));
+                return _mm256_movemask_ps(_mm256_castsi256_ps(_Eq));
+            }
+
+            static __m256i _Min(const __m256i _First, const __m256i _Second) noexcept {
+                return _mm256_min_epi32(_First, _Second);
+            }
+
+            static __m256i _Max(const __m256i _First, const __m256i _Second) noexcept {
+                return _mm256_max_epi32(_First, _Second);
+            }
+
+            static __m256i _Reverse(const __m256i _Val) noexcept {
+                return _mm256_permutevar8x32_epi32(_Val, _mm256_set_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+            }
+
+            static __m256i _Sort_bitonic(__m256i _Val) noexcept {
+                __m256i _Swapped = _mm256_permute2x128_si256(_Val, _Val, 0x01);
+                _Val             = _mm256_blend_epi32(_Min(_Val, _Swapped), _Max(_Val, _Swapped), 0xF0);
+                _Swapped         = _mm256_shuffle_epi32(_Val, _MM_SHUFFLE(1, 0, 3, 2));
+                _Val             = _mm256_blend_epi32(_Min(_Val, _Swapped), _Max(_Val, _Swapped), 0xCC);
+                _Swapped         = _mm256_shuffle_epi32(_Val, _MM_SHUFFLE(2, 3, 0, 1));
+                return _mm256_blend_epi32(_Min(_Val, _Swapped), _Max(_Val, _Swapped), 0xAA);
+            }
+
+            static __m256i _Shift_in(const __m256i _Prev, const __m256i _Val) noexcept {
+                // The last element of _Prev followed by all but the last element of _Val
+                return _mm256_alignr_epi8(_Val, _mm256_permute2x128_si256(_Prev, _Val, 0x21), 12);
+            }
+        };
+
+        struct _Traits_8_sse : _Partitioning::_Traits_8_sse {
+            static uint32_t _Mask_eq(const __m128i _First, const __m128i _Second) noexcept {
+                return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(_First, _Second)));
+            }
+
+            static uint32_t _Mask_match(const __m128i _First, const __m128i _Second) noexcept {
+                const __m128i _Eq0 = _mm_cmpeq_epi64(_First, _Second);
+                const __m128i _Eq1 = _mm_cmpeq_epi64(_First, _mm_shuffle_epi32(_Second, _MM_SHUFFLE(1, 0, 3, 2)));
+                return _mm_movemask_pd(_mm_castsi128_pd(_mm_or_si128(_Eq0, _Eq1)));
+            }
+
+            static __m128i _Min(const __m128i _First, const __m128i _Second) noexcept {
+                return _mm_blendv_epi8(_First, _Second, _mm_cmpgt_epi64(_First, _Second));
+            }
+
+            static __m128i _Max(const __m128i _First, const __m128i _Second) noexcept {
+                return _mm_blendv_epi8(_Second, _First, _mm_cmpgt_epi64(_First, _Second));
+            }
+
+            static __m128i _Reverse(const __m128i _Val) noexcept {
+                return _mm_shuffle_epi32(_Val, _MM_SHUFFLE(1, 0, 3, 2));
+            }
+
+            static __m128i _Sort_bitonic(const __m128i _Val) noexcept {
+                const __m128i _Swapped = _mm_shuffle_epi32(_Val, _MM_SHUFFLE(1, 0, 3, 2));
+                return _mm_blend_epi16(_Min(_Val, _Swapped), _Max(_Val, _Swapped), 0xF0);
+            }
+
+            static __m128i _Shift_in(const __m128i _Prev, const __m128i _Val) noexcept {
+                return _mm_alignr_epi8(_Val, _Prev, 8);
+            }
+        };
+
+        struct _Traits_8_avx : _Partitioning::_Traits_8_avx {
+            static uint32_t _Mask_eq(const __m256i _First, const __m256i _Second) noexcept {
+                return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_First, _Second)));
+            }
+
+            static uint32_t _Mask_match(const __m256i _First, const __m256i _Second) noexcept {
+                const __m256i _Swapped = _mm256_permute4x64_epi64(_Second, _MM_SHUFFLE(1, 0, 3, 2));
+                const __m256i _Eq0     = _mm256_or_si256(
+                    _mm256_cmpeq_epi64(_First, _Second), _mm256_cmpeq_epi64(_First, _Swapped));
+                const __m256i _Eq1 = _mm256_or_si256(
+                    _mm256_cmpeq_epi64(_First, _mm256_shuffle_epi32(_Second, _MM_SHUFFLE(1, 0, 3, 2))),
+                    _mm256_cmpeq_epi64(_First, _mm256_shuffle_epi32(_Swapped, _MM_SHUFFLE(1, 0, 3, 2))));
+                return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_or_si256(_Eq0, _Eq1)));
+            }
+
+            static __m256i _Min(const __m256i _First, const __m256i _Second) noexcept {
+                return _mm256_blendv_epi8(_First, _Second, _mm256_cmpgt_epi64(_First, _Second));
+            }
+
+            static __m256i _Max(const __m256i _First, const __m256i _Second) noexcept {
+                return _mm256_blendv_epi8(_Second, _First, _mm256_cmpgt_epi64(_First, _Second));
+            }
+
+            static __m256i _Reverse(const __m256i _Val) noexcept {
+                return _mm256_permute4x64_epi64(_Val, _MM_SHUFFLE(0, 1, 2, 3));
+            }
+
+            static __m256i _Sort_bitonic(__m256i _Val) noexcept {
+                __m256i _Swapped = _mm256_permute4x64_epi64(_Val, _MM_SHUFFLE(1, 0, 3, 2));
+                _Val             = _mm256_blend_epi32(_Min(_Val, _Swapped), _Max(_Val, _Swapped), 0xF0);
+                _Swapped         = _mm256_shuffle_epi32(_Val, _MM_SHUFFLE(1, 0, 3, 2));
+                return _mm256_blend_epi32(_Min(_Val, _Swapped), _Max(_Val, _Swapped), 0xCC);
+            }
+
+            static __m256i _Shift_in(const __m256i _Prev, const __m256i _Val) noexcept {
+                return _mm256_alignr_epi8(_Val, _mm256_permute2x128_si256(_Prev, _Val, 0x21), 8);
+            }
+        };
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        // The scalar loops below perform at most _Steps steps of the usual algorithms, and stop when either
+        // range runs out; the vectorized loops use them to step past repeated elements.
+
+        template <bool _Union, class _Ty>
+        _Ty* _Merge_scalar(const _Ty*& _First1, const _Ty* const _Last1, const _Ty*& _First2,
+            const _Ty* const _Last2, _Ty* _Dest, size_t _Steps) noexcept {
+            for (; _Steps != 0 && _First1 != _Last1 && _First2 != _Last2; --_Steps, ++_Dest) {
+                if (*_First2 < *_First1) {
+                    *_Dest = *_First2;
+                    ++_First2;
+                } else {
+                    if constexpr (_Union) {
+                        if (!(*_First1 < *_First2)) {
+                            ++_First2;
+                        }
+                    }
+
+                    *_Dest = *_First1;
+                    ++_First1;
+                }
+            }
+
+            return _Dest;
+        }
+
+        template <bool _Difference, class _Ty>
+        _Ty* _Match_scalar(const _Ty*& _First1, const _Ty* const _Last1, const _Ty*& _First2,
+            const _Ty* const _Last2, _Ty* _Dest, size_t _Steps) noexcept {
+            // set_intersection outputs the matched elements, set_difference the unmatched elements of the first range
+            for (; _Steps != 0 && _First1 != _Last1 && _First2 != _Last2; --_Steps) {
+                if (*_First1 < *_First2) {
+                    if constexpr (_Difference) {
+                        *_Dest = *_First1;
+                        ++_Dest;
+                    }
+
+                    ++_First1;
+                } else if (*_First2 < *_First1) {
+                    ++_First2;
+                } else {
+                    if constexpr (!_Difference) {
+                        *_Dest = *_First1;
+                        ++_Dest;
+                    }
+
+                    ++_First1;
+                    ++_First2;
+                }
+            }
+
+            return _Dest;
+        }
+
+        template <class _Ty>
+        _Ty* _Copy_rest(const _Ty* const _First, const _Ty* const _Last, _Ty* const _Dest) noexcept {
+            if (_First == _Last) {
+                return _Dest; // _First may be null, which memcpy doesn't allow even for a count of 0
+            }
+
+            const size_t _Count = static_cast<size_t>(_Last - _First);
+            memcpy(_Dest, _First, _Count * sizeof(_Ty));
+            return _Dest + _Count;
+        }
+
+        template <bool _Union, class _Ty, size_t _Count>
+        _Ty* _Merge_carry(const _Ty (&_Carry)[_Count], const _Ty*& _First1, const _Ty* const _Last1,
+            const _Ty*& _First2, const _Ty* const _Last2, _Ty* _Dest) noexcept {
+            // Merges the sorted carried elements into the rest of the ranges, until the carried elements run out
+            const _Ty* _Ptr       = _Carry;
+            const _Ty* const _End = _Carry + _Count;
+
+            // For set_union, the ranges had distinct elements so far, so the last output element and each carried
+            // element have at most one counterpart from the other range: either among the carried elements,
+            // or at the beginning of the rest of that range.
+            const auto _Skip_counterpart = [&](const _Ty _Val) noexcept {
+                if (_Ptr != _End && *_Ptr == _Val) {
+                    ++_Ptr;
+                }
+
+                if (_First1 != _Last1 && *_First1 == _Val) {
+                    ++_First1;
+                }
+
+                if (_First2 != _Last2 && *_First2 == _Val) {
+                    ++_First2;
+                }
+            };
+
+            if constexpr (_Union) {
+                _Skip_counterpart(_Dest[-1]);
+            }
+
+            for (; _Ptr != _End; ++_Dest) {
+                const _Ty _Val = *_Ptr;
+                if (_First1 != _Last1 && *_First1 < _Val && (_First2 == _Last2 || !(*_First2 < *_First1))) {
+                    if constexpr (_Union) {
+                        if (_First2 != _Last2 && !(*_First1 < *_First2)) {
+                            ++_First2;
+                        }
+                    }
+
+                    *_Dest = *_First1;
+                    ++_First1;
+                } else if (_First2 != _Last2 && *_First2 < _Val) {
+                    *_Dest = *_First2;
+                    ++_First2;
+                } else {
+                    *_Dest = _Val;
+                    ++_Ptr;
+                    if constexpr (_Union) {
+                        _Skip_counterpart(_Val);
+                    }
+                }
+            }
+
+            return _Dest;
+        }
+
+#ifndef _M_ARM64EC
+        template <class _Traits, class _Ty>
+        bool _Distinct(const _Ty* const _Src) noexcept {
+            // Whether the block elements are distinct and less than the element after the block
+            return _Traits::_Mask_eq(_Traits::_Load(_Src), _Traits::_Load(_Src + 1)) == 0;
+        }
+
+        template <class _Traits>
+        void _Merge_vectors(typename _Traits::_Vec& _Lo, typename _Traits::_Vec& _Hi) noexcept {
+            // Bitonic merge network: given sorted _Lo and _Hi, puts the lesser half into _Lo, the greater into _Hi.
+            // _Hi is carried between the calls, so _Lo is the one reversed, to keep that off the dependency chain.
+            const auto _Rev = _Traits::_Reverse(_Lo);
+            _Lo             = _Traits::_Sort_bitonic(_Traits::_Min(_Hi, _Rev));
+            _Hi             = _Traits::_Sort_bitonic(_Traits::_Max(_Hi, _Rev));
+        }
+
+        template <class _Traits, bool _Union, class _Ty>
+        _Ty* _Merge_blocks(const _Ty*& _First1, const _Ty* const _Last1, const _Ty*& _First2,
+            const _Ty* const _Last2, _Ty* _Dest) noexcept {
+            // pre: both ranges have at least _Block_need elements; for set_union, their first blocks are _Distinct
+            constexpr size_t _Lanes      = _Traits::_Lanes;
+            constexpr size_t _Block_need = _Union ? _Lanes + 1 : _Lanes;
+            constexpr bool _Sign_cor     = static_cast<_Ty>(-1) > _Ty{0};
+            constexpr uint32_t _All_mask = (1u << _Lanes) - 1;
+
+            // The elements are merged in the signed domain; the correction is its own inverse
+            const auto _Correct = [](const typename _Traits::_Vec _Val) noexcept {
+                if constexpr (_Sign_cor) {
+                    return _Traits::_Sign_correction(_Val);
+                } else {
+                    return _Val;
+                }
+            };
+
+            auto _Lo = _Correct(_Traits::_Load(_First1));
+            auto _Hi = _Correct(_Traits::_Load(_First2));
+            _First1 += _Lanes;
+            _First2 += _Lanes;
+
+            auto _Prev          = _Lo;
+            uint32_t _Dup_lanes = _All_mask & ~1u; // The first merged vector has no preceding element
+
+            for (;;) {
+                // _Hi is carried to the next step, the elements of _Lo are the next ones in the output
+                _Merge_vectors<_Traits>(_Lo, _Hi);
+                if constexpr (_Union) {
+                    // Equal adjacent elements are the counterparts from both ranges; only the first one is kept.
+                    // Each value occurs at most twice among the remaining elements, so the output gets at least
+                    // _Lanes more elements, and the whole vector can be stored.
+                    const uint32_t _Keep = (_Traits::_Mask_eq(_Lo, _Traits::_Shift_in(_Prev, _Lo)) & _Dup_lanes)
+                                         ^ _All_mask;
+                    _Traits::_Store(_Dest, _Correct(_Traits::_Partition(_Lo, _Keep)));
+                    _Dest += __popcnt(_Keep); // Assume available with SSE4.2
+                    _Prev      = _Lo;
+                    _Dup_lanes = _All_mask;
+                } else {
+                    _Traits::_Store(_Dest, _Correct(_Lo));
+                    _Dest += _Lanes;
+                }
+
+                if (static_cast<size_t>(_Last1 - _First1) < _Block_need
+                    || static_cast<size_t>(_Last2 - _First2) < _Block_need) {
+                    break;
+                }
+
+                // The next block comes from the range with the lesser next element,
+                // then the output elements are never greater than the elements not loaded yet.
+                // The choice is unpredictable, so it is made without branches.
+                const bool _Take1     = !(*_First2 < *_First1);
+                const _Ty* const _Src = _Take1 ? _First1 : _First2;
+                if constexpr (_Union) {
+                    if (!_Distinct<_Traits>(_Src)) {
+                        break;
+                    }
+                }
+
+                _Lo = _Correct(_Traits::_Load(_Src));
+                _First1 += _Take1 ? _Lanes : 0;
+                _First2 += _Take1 ? 0 : _Lanes;
+            }
+
+            _Ty _Carry[_Lanes];
+            _Traits::_Store(_Carry, _Correct(_Hi));
+            return _Merge_carry<_Union>(_Carry, _First1, _Last1, _First2, _Last2, _Dest);
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <class _Traits, bool _Union, class _Ty>
+        _Ty* _Merge_impl(const _Ty* _First1, const _Ty* const _Last1, const _Ty* _First2, const _Ty* const _Last2,
+            _Ty* _Dest) noexcept {
+            if constexpr (!std::is_void_v<_Traits>) {
+#ifdef _M_ARM64EC
+                static_assert(false, "No vectorization for _M_ARM64EC yet");
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+                // For set_union, each block needs one more element after it to check that it is _Distinct
+                constexpr size_t _Lanes      = _Traits::_Lanes;
+                constexpr size_t _Block_need = _Union ? _Lanes + 1 : _Lanes;
+
+                while (static_cast<size_t>(_Last1 - _First1) >= _Block_need
+                       && static_cast<size_t>(_Last2 - _First2) >= _Block_need) {
+                    if constexpr (_Union) {
+                        if (!_Distinct<_Traits>(_First1) || !_Distinct<_Traits>(_First2)) {
+                            _Dest = _Merge_scalar<_Union>(_First1, _Last1, _First2, _Last2, _Dest, 2 * _Lanes);
+                            continue;
+                        }
+                    }
+
+                    _Dest = _Merge_blocks<_Traits, _Union>(_First1, _Last1, _First2, _Last2, _Dest);
+                }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            }
+
+            _Dest = _Merge_scalar<_Union>(_First1, _Last1, _First2, _Last2, _Dest, SIZE_MAX);
+            _Dest = _Copy_rest(_First1, _Last1, _Dest);
+            return _Copy_rest(_First2, _Last2, _Dest);
+        }
+
+        template <class _Traits, bool _Difference, class _Ty>
+        _Ty* _Match_impl(const _Ty* _First1, const _Ty* const _Last1, const _Ty* _First2, const _Ty* const _Last2,
+            _Ty* _Dest) noexcept {
+            if constexpr (!std::is_void_v<_Traits>) {
+#ifdef _M_ARM64EC
+                static_assert(false, "No vectorization for _M_ARM64EC yet");
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+                constexpr size_t _Lanes      = _Traits::_Lanes;
+                constexpr size_t _Stage_size = _Stage_bytes / sizeof(_Ty);
+                constexpr bool _Sign_cor     = static_cast<_Ty>(-1) > _Ty{0};
+                constexpr uint32_t _All_mask = (1u << _Lanes) - 1;
+
+                _Ty _Stage[_Stage_size];
+                size_t _Staged    = 0;
+                const auto _Flush = [&_Stage, &_Staged, &_Dest]() noexcept {
+                    memcpy(_Dest, _Stage, _Staged * sizeof(_Ty));
+                    _Dest += _Staged;
+                    _Staged = 0;
+                };
+
+                // Each step compares all pairs of elements from a block of each range. The blocks must be
+                // _Distinct, otherwise an element could be matched more than once; this needs one more element.
+                while (static_cast<size_t>(_Last1 - _First1) > _Lanes
+                       && static_cast<size_t>(_Last2 - _First2) > _Lanes) {
+                    const auto _Data1 = _Traits::_Load(_First1);
+                    const auto _Data2 = _Traits::_Load(_First2);
+                    if ((_Traits::_Mask_eq(_Data1, _Traits::_Load(_First1 + 1))
+                            | _Traits::_Mask_eq(_Data2, _Traits::_Load(_First2 + 1)))
+                        != 0) {
+                        _Flush();
+                        _Dest = _Match_scalar<_Difference>(_First1, _Last1, _First2, _Last2, _Dest, 2 * _Lanes);
+                        continue;
+                    }
+
+                    const _Ty _Back1 = _First1[_Lanes - 1];
+                    const _Ty _Back2 = _First2[_Lanes - 1];
+                    const uint32_t _Matched = _Traits::_Mask_match(_Data1, _Data2);
+
+                    uint32_t _Bingo;
+                    if constexpr (_Difference) {
+                        // The elements of the first block up to _Back2 are decided, as the rest of the second range
+                        // is greater; they are a prefix of the block.
+                        auto _Cmp1      = _Data1;
+                        auto _Back2_vec = _Traits::_Set(_Back2);
+                        if constexpr (_Sign_cor) {
+                            _Cmp1      = _Traits::_Sign_correction(_Cmp1);
+                            _Back2_vec = _Traits::_Sign_correction(_Back2_vec);
+                        }
+
+                        const uint32_t _Decided = _Traits::_Mask_gt(_Cmp1, _Back2_vec) ^ _All_mask;
+                        _Bingo                  = _Decided & ~_Matched;
+                        _First1 += __popcnt(_Decided); // Assume available with SSE4.2
+                        _First2 += _Back1 < _Back2 ? 0 : _Lanes;
+                    } else {
+                        // The block that ends first has no more matches
+                        _Bingo = _Matched;
+                        _First1 += _Back2 < _Back1 ? 0 : _Lanes;
+                        _First2 += _Back1 < _Back2 ? 0 : _Lanes;
+                    }
+
+                    _Traits::_Store(_Stage + _Staged, _Traits::_Partition(_Data1, _Bingo));
+                    _Staged += __popcnt(_Bingo);
+                    if (_Staged > _Stage_size - _Lanes) {
+                        _Flush();
+                    }
+                }
+
+                _Flush();
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            }
+
+            _Dest = _Match_scalar<_Difference>(_First1, _Last1, _First2, _Last2, _Dest, SIZE_MAX);
+            if constexpr (_Difference) {
+                _Dest = _Copy_rest(_First1, _Last1, _Dest);
+            }
+
+            return _Dest;
+        }
+
+        template <class _Traits, _Set_op _Op, class _Ty>
+        _Ty* _Set_impl(const _Ty* const _First1, const _Ty* const _Last1, const _Ty* const _First2,
+            const _Ty* const _Last2, _Ty* const _Dest) noexcept {
+            if constexpr (_Op == _Set_op::_Merge || _Op == _Set_op::_Union) {
+                return _Merge_impl<_Traits, _Op == _Set_op::_Union>(_First1, _Last1, _First2, _Last2, _Dest);
+            } else {
+                return _Match_impl<_Traits, _Op == _Set_op::_Difference>(_First1, _Last1, _First2, _Last2, _Dest);
+            }
+        }
+
+        template <class _Traits_avx, class _Traits_sse, _Set_op _Op, class _Ty>
+        void* __stdcall _Set_disp(const void* const _First1, const void* const _Last1, const void* const _First2,
+            const void* const _Last2, void* const _Dest) noexcept {
+            const auto _First1_ptr = static_cast<const _Ty*>(_First1);
+            const auto _Last1_ptr  = static_cast<const _Ty*>(_Last1);
+            const auto _First2_ptr = static_cast<const _Ty*>(_First2);
+            const auto _Last2_ptr  = static_cast<const _Ty*>(_Last2);
+            const auto _Dest_ptr   = static_cast<_Ty*>(_Dest);
+#ifndef _M_ARM64EC
+            if (_Use_avx2()) {
+                [[maybe_unused]] typename _Traits_avx::_Guard _Guard; // TRANSITION, DevCom-10331414
+                return _Set_impl<_Traits_avx, _Op>(_First1_ptr, _Last1_ptr, _First2_ptr, _Last2_ptr, _Dest_ptr);
+            }
+
+            if (_Use_sse42()) {
+                return _Set_impl<_Traits_sse, _Op>(_First1_ptr, _Last1_ptr, _First2_ptr, _Last2_ptr, _Dest_ptr);
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+            return _Set_impl<void, _Op>(_First1_ptr, _Last1_ptr, _First2_ptr, _Last2_ptr, _Dest_ptr);
+        }
+    } // namespace _Set_operations
+} // unnamed namespace
+
+extern "C" {
+
+void* __stdcall __std_merge_less_4i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_4_avx, _Set_operations::_Traits_4_sse,
+        _Set_operations::_Set_op::_Merge, int32_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_merge_less_4u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_4_avx, _Set_operations::_Traits_4_sse,
+        _Set_operations::_Set_op::_Merge, uint32_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_merge_less_8i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_8_avx, _Set_operations::_Traits_8_sse,
+        _Set_operations::_Set_op::_Merge, int64_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_merge_less_8u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_8_avx, _Set_operations::_Traits_8_sse,
+        _Set_operations::_Set_op::_Merge, uint64_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_difference_less_4i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_4_avx, _Set_operations::_Traits_4_sse,
+        _Set_operations::_Set_op::_Difference, int32_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_difference_less_4u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_4_avx, _Set_operations::_Traits_4_sse,
+        _Set_operations::_Set_op::_Difference, uint32_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_difference_less_8i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_8_avx, _Set_operations::_Traits_8_sse,
+        _Set_operations::_Set_op::_Difference, int64_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_difference_less_8u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_8_avx, _Set_operations::_Traits_8_sse,
+        _Set_operations::_Set_op::_Difference, uint64_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_intersection_less_4i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_4_avx, _Set_operations::_Traits_4_sse,
+        _Set_operations::_Set_op::_Intersection, int32_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_intersection_less_4u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_4_avx, _Set_operations::_Traits_4_sse,
+        _Set_operations::_Set_op::_Intersection, uint32_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_intersection_less_8i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_8_avx, _Set_operations::_Traits_8_sse,
+        _Set_operations::_Set_op::_Intersection, int64_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_intersection_less_8u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_8_avx, _Set_operations::_Traits_8_sse,
+        _Set_operations::_Set_op::_Intersection, uint64_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_union_less_4i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_4_avx, _Set_operations::_Traits_4_sse,
+        _Set_operations::_Set_op::_Union, int32_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_union_less_4u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_4_avx, _Set_operations::_Traits_4_sse,
+        _Set_operations::_Set_op::_Union, uint32_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_union_less_8i(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_8_avx, _Set_operations::_Traits_8_sse,
+        _Set_operations::_Set_op::_Union, int64_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+void* __stdcall __std_set_union_less_8u(const void* const _First1, const void* const _Last1,
+    const void* const _First2, const void* const _Last2, void* const _Dest) noexcept {
+    return _Set_operations::_Set_disp<_Set_operations::_Traits_8_avx, _Set_operations::_Traits_8_sse,
+        _Set_operations::_Set_op::_Union, uint64_t>(_First1, _Last1, _First2, _Last2, _Dest);
+}
+
+} // extern "C"
+
+namespace {
+    namespace _Reducing {
+        template <class _Ty>
+        _Ty _Reduce_plus_fallback(const void* const _First, const void* const _Last, _Ty _Result) noexcept {
+            for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+                _Result += *_Ptr;
+            }
+
+            return _Result;
+        }
+
+        template <class _Ty>
+        _Ty _Dot_product_fallback(
+            const void* const _First1, const void* const _Last1, const void* const _First2, _Ty _Result) noexcept {
+            auto _Ptr2 = static_cast<const _Ty*>(_First2);
+            for (auto _Ptr1 = static_cast<const _Ty*>(_First1); _Ptr1 != _Last1; ++_Ptr1, ++_Ptr2) {
+                _Result += *_Ptr1 * *_Ptr2;
+            }
+
+            return _Result;
+        }
+
+#ifdef _M_ARM64EC
+        using _Traits_4_avx512 = void;
+        using _Traits_4_avx    = void;
+        using _Traits_4_sse    = void;
+        using _Traits_8_avx512 = void;
+        using _Traits_8_avx    = void;
+        using _Traits_8_sse    = void;
+        using _Traits_f_avx512 = void;
+        using _Traits_f_avx    = void;
+        using _Traits_f_sse    = void;
+        using _Traits_d_avx512 = void;
+        using _Traits_d_avx    = void;
+        using _Traits_d_sse    = void;
+#else // ^^^ defined(_M_ARM64EC) / !defined(_M_ARM64EC) vvv
+        struct _Traits_4_sse {
+            using _Guard = char;
+            using _Elem  = uint32_t;
+            using _Vec   = __m128i;
+
+            static constexpr size_t _Vec_size = 16;
+
+            static __m128i _Identity() noexcept {
+                return _mm_setzero_si128();
+            }
+
+            static __m128i _Load(const void* const _Src) noexcept {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src));
+            }
+
+            static __m128i _Add(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+                return _mm_add_epi32(_Lhs, _Rhs);
+            }
+
+            static uint32_t _H_sum(const __m128i _Val) noexcept {
+                const __m128i _Rx1 = _mm_add_epi32(_Val, _mm_unpackhi_epi64(_Val, _Val));
+                const __m128i _Rx2 = _mm_add_epi32(_Rx1, _mm_shuffle_epi32(_Rx1, _MM_SHUFFLE(1, 1, 1, 1)));
+                return static_cast<uint32_t>(_mm_cvtsi128_si32(_Rx2));
+            }
+        };
+
+        struct _Traits_4_avx {
+            using _Guard = _Zeroupper_on_exit;
+            using _Elem  = uint32_t;
+            using _Vec   = __m256i;
+
+            static constexpr size_t _Vec_size = 32;
+
+            static __m256i _Identity() noexcept {
+                return _mm256_setzero_si256();
+            }
+
+            static __m256i _Load(const void* const _Src) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+            }
+
+            static __m256i _Add(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_add_epi32(_Lhs, _Rhs);
+            }
+
+            static uint32_t _H_sum(const __m256i _Val) noexcept {
+                const __m128i _Lo = _mm256_castsi256_si128(_Val);
+                const __m128i _Hi = _mm256_extracti128_si256(_Val, 1);
+                return _Traits_4_sse::_H_sum(_mm_add_epi32(_Lo, _Hi));
+            }
+        };
+
+        struct _Traits_4_avx512 {
+            using _Guard = _Zeroupper_on_exit;
+            using _Elem  = uint32_t;
+            using _Vec   = __m512i;
+
+            static constexpr size_t _Vec_size = 64;
+
+            static __m512i _Identity() noexcept {
+                return _mm512_setzero_si512();
+            }
+
+            static __m512i _Load(const void* const _Src) noexcept {
+                return _mm512_loadu_si512(_Src);
+            }
+
+            static __m512i _Add(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+                return _mm512_add_epi32(_Lhs, _Rhs);
+            }
+
+            static uint32_t _H_sum(const __m512i _Val) noexcept {
+                const __m256i _Lo = _mm512_castsi512_si256(_Val);
+                const __m256i _Hi = _mm512_extracti64x4_epi64(_Val, 1);
+                return _Traits_4_avx::_H_sum(_mm256_add_epi32(_Lo, _Hi));
+            }
+        };
+
+        struct _Traits_8_sse {
+            using _Guard = char;
+            using _Elem  = uint64_t;
+            using _Vec   = __m128i;
+
+            static constexpr size_t _Vec_size = 16;
+
+            static __m128i _Identity() noexcept {
+                return _mm_setzero_si128();
+            }
+
+            static __m128i _Load(const void* const _Src) noexcept {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src));
+            }
+
+            static __m128i _Add(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+                return _mm_add_epi64(_Lhs, _Rhs);
+            }
+
+            static uint64_t _H_sum(const __m128i _Val) noexcept {
+                const __m128i _Rx1 = _mm_add_epi64(_Val, _mm_unpackhi_epi64(_Val, _Val));
+#ifdef _M_IX86
+                return static_cast<uint32_t>(_mm_cvtsi128_si32(_Rx1))
+                     | (uint64_t{static_cast<uint32_t>(_mm_extract_epi32(_Rx1, 1))} << 32);
+#else // ^^^ defined(_M_IX86) / defined(_M_X64) vvv
+                return static_cast<uint64_t>(_mm_cvtsi128_si64(_Rx1));
+#endif // ^^^ defined(_M_X64) ^^^
+            }
+        };
+
+        struct _Traits_8_avx {
+            using _Guard = _Zeroupper_on_exit;
+            using _Elem  = uint64_t;
+            using _Vec   = __m256i;
+
+            static constexpr size_t _Vec_size = 32;
+
+            static __m256i _Identity() noexcept {
+                return _mm256_setzero_si256();
+            }
+
+            static __m256i _Load(const void* const _Src) noexcept {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+            }
+
+            static __m256i _Add(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+                return _mm256_add_epi64(_Lhs, _Rhs);
+            }
+
+            static uint64_t _H_sum(const __m256i _Val) noexcept {
+                const __m128i _Lo = _mm256_castsi256_si128(_Val);
+                const __m128i _Hi = _mm256_extracti128_si256(_Val, 1);
+                return _Traits_8_sse::_H_sum(_mm_add_epi64(_Lo, _Hi));
+            }
+        };
+
+        struct _Traits_8_avx512 {
+            using _Guard = _Zeroupper_on_exit;
+            using _Elem  = uint64_t;
+            using _Vec   = __m512i;
+
+            static constexpr size_t _Vec_size = 64;
+
+            static __m512i _Identity() noexcept {
+                return _mm512_setzero_si512();
+            }
+
+            static __m512i _Load(const void* const _Src) noexcept {
+                return _mm512_loadu_si512(_Src);
+            }
+
+            static __m512i _Add(const __m512i _Lhs, const __m512i _Rhs) noexcept {
+                return _mm512_add_epi64(_Lhs, _Rhs);
+            }
+
+            static uint64_t _H_sum(const __m512i _Val) noexcept {
+                const __m256i _Lo = _mm512_castsi512_si256(_Val);
+                const __m256i _Hi = _mm512_extracti64x4_epi64(_Val, 1);
+                return _Traits_8_avx::_H_sum(_mm256_add_epi64(_Lo, _Hi));
+            }
+        };
+
+        // The floating-point accumulators start at -0.0, which is the identity of addition, unlike +0.0.
+        // Multiplication and addition are kept separate, so that the result doesn't depend on FMA availability.
+
+        struct _Traits_f_sse {
+            using _Guard = char;
+            using _Elem  = float;
+            using _Vec   = __m128;
+
+            static constexpr size_t _Vec_size = 16;
+
+            static __m128 _Identity() noexcept {
+                return _mm_set1_ps(-0.0f);
+            }
+
+            static __m128 _Load(const void* const _Src) noexcept {
+                return _mm_loadu_ps(static_cast<const float*>(_Src));
+            }
+
+            static __m128 _Add(const __m128 _Lhs, const __m128 _Rhs) noexcept {
+                return _mm_add_ps(_Lhs, _Rhs);
+            }
+
+            static __m128 _Mul(const __m128 _Lhs, const __m128 _Rhs) noexcept {
+                return _mm_mul_ps(_Lhs, _Rhs);
+            }
+
+            static float _H_sum(const __m128 _Val) noexcept {
+                const __m128 _Rx1 = _mm_add_ps(_Val, _mm_movehl_ps(_Val, _Val));
+                const __m128 _Rx2 = _mm_add_ss(_Rx1, _mm_shuffle_ps(_Rx1, _Rx1, _MM_SHUFFLE(1, 1, 1, 1)));
+                return _mm_cvtss_f32(_Rx2);
+            }
+        };
+
+        struct _Traits_f_avx {
+            using _Guard = _Zeroupper_on_exit;
+            using _Elem  = float;
+            using _Vec   = __m256;
+
+            static constexpr size_t _Vec_size = 32;
+
+            static __m256 _Identity() noexcept {
+                return _mm256_set1_ps(-0.0f);
+            }
+
+            static __m256 _Load(const void* const _Src) noexcept {
+                return _mm256_loadu_ps(static_cast<const float*>(_Src));
+            }
+
+            static __m256 _Add(const __m256 _Lhs, const __m256 _Rhs) noexcept {
+                return _mm256_add_ps(_Lhs, _Rhs);
+            }
+
+            static __m256 _Mul(const __m256 _Lhs, const __m256 _Rhs) noexcept {
+                return _mm256_mul_ps(_Lhs, _Rhs);
+            }
+
+            static float _H_sum(const __m256 _Val) noexcept {
+                const __m128 _Lo = _mm256_castps256_ps128(_Val);
+                const __m128 _Hi = _mm256_extractf128_ps(_Val, 1);
+                return _Traits_f_sse::_H_sum(_mm_add_ps(_Lo, _Hi));
+            }
+        };
+
+        struct _Traits_f_avx512 {
+            using _Guard = _Zeroupper_on_exit;
+            using _Elem  = float;
+            using _Vec   = __m512;
+
+            static constexpr size_t _Vec_size = 64;
+
+            static __m512 _Identity() noexcept {
+                return _mm512_set1_ps(-0.0f);
+            }
+
+            static __m512 _Load(const void* const _Src) noexcept {
+                return _mm512_loadu_ps(_Src);
+            }
+
+            static __m512 _Add(const __m512 _Lhs, const __m512 _Rhs) noexcept {
+                return _mm512_add_ps(_Lhs, _Rhs);
+            }
+
+            static __m512 _Mul(const __m512 _Lhs, const __m512 _Rhs) noexcept {
+                return _mm512_mul_ps(_Lhs, _Rhs);
+            }
+
+            static float _H_sum(const __m512 _Val) noexcept {
+                const __m256 _Lo = _mm512_castps512_ps256(_Val);
+                const __m256 _Hi = _mm512_extractf32x8_ps(_Val, 1);
+                return _Traits_f_avx::_H_sum(_mm256_add_ps(_Lo, _Hi));
+            }
+        };
+
+        struct _Traits_d_sse {
+            using _Guard = char;
+            using _Elem  = double;
+            using _Vec   = __m128d;
+
+            static constexpr size_t _Vec_size = 16;
+
+            static __m128d _Identity() noexcept {
+                return _mm_set1_pd(-0.0);
+            }
+
+            static __m128d _Load(const void* const _Src) noexcept {
+                return _mm_loadu_pd(static_cast<const double*>(_Src));
+            }
+
+            static __m128d _Add(const __m128d _Lhs, const __m128d _Rhs) noexcept {
+                return _mm_add_pd(_Lhs, _Rhs);
+            }
+
+            static __m128d _Mul(const __m128d _Lhs, const __m128d _Rhs) noexcept {
+                return _mm_mul_pd(_Lhs, _Rhs);
+            }
+
+            static double _H_sum(const __m128d _Val) noexcept {
+                return _mm_cvtsd_f64(_mm_add_sd(_Val, _mm_unpackhi_pd(_Val, _Val)));
+            }
+        };
+
+        struct _Traits_d_avx {
+            using _Guard = _Zeroupper_on_exit;
+            using _Elem  = double;
+            using _Vec   = __m256d;
+
+            static constexpr size_t _Vec_size = 32;
+
+            static __m256d _Identity() noexcept {
+                return _mm256_set1_pd(-0.0);
+            }
+
+            static __m256d _Load(const void* const _Src) noexcept {
+                return _mm256_loadu_pd(static_cast<const double*>(_Src));
+            }
+
+            static __m256d _Add(const __m256d _Lhs, const __m256d _Rhs) noexcept {
+                return _mm256_add_pd(_Lhs, _Rhs);
+            }
+
+            static __m256d _Mul(const __m256d _Lhs, const __m256d _Rhs) noexcept {
+                return _mm256_mul_pd(_Lhs, _Rhs);
+            }
+
+            static double _H_sum(const __m256d _Val) noexcept {
+                const __m128d _Lo = _mm256_castpd256_pd128(_Val);
+                const __m128d _Hi = _mm256_extractf128_pd(_Val, 1);
+                return _Traits_d_sse::_H_sum(_mm_add_pd(_Lo, _Hi));
+            }
+        };
+
+        struct _Traits_d_avx512 {
+            using _Guard = _Zeroupper_on_exit;
+            using _Elem  = double;
+            using _Vec   = __m512d;
+
+            static constexpr size_t _Vec_size = 64;
+
+            static __m512d _Identity() noexcept {
+                return _mm512_set1_pd(-0.0);
+            }
+
+            static __m512d _Load(const void* const _Src) noexcept {
+                return _mm512_loadu_pd(_Src);
+            }
+
+            static __m512d _Add(const __m512d _Lhs, const __m512d _Rhs) noexcept {
+                return _mm512_add_pd(_Lhs, _Rhs);
+            }
+
+            static __m512d _Mul(const __m512d _Lhs, const __m512d _Rhs) noexcept {
+                return _mm512_mul_pd(_Lhs, _Rhs);
+            }
+
+            static double _H_sum(const __m512d _Val) noexcept {
+                const __m256d _Lo = _mm512_castpd512_pd256(_Val);
+                const __m256d _Hi = _mm512_extractf64x4_pd(_Val, 1);
+                return _Traits_d_avx::_H_sum(_mm256_add_pd(_Lo, _Hi));
+            }
+        };
+
+        // Four independent accumulators hide the latency of the additions.
+        // The caller handles the elements that don't fill a vector, and passes at least four vectors' worth.
+
+        template <class _Traits>
+        typename _Traits::_Elem _Reduce_plus_impl(const void*& _First, const void* const _Last) noexcept {
+            [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+
+            constexpr size_t _Vec_size = _Traits::_Vec_size;
+            const size_t _Size_bytes   = _Byte_length(_First, _Last);
+
+            auto _Acc0 = _Traits::_Identity();
+            auto _Acc1 = _Acc0;
+            auto _Acc2 = _Acc0;
+            auto _Acc3 = _Acc0;
+
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~(_Vec_size * 4 - 1));
+
+            do {
+                auto _Src = static_cast<const unsigned char*>(_First);
+                _Acc0     = _Traits::_Add(_Acc0, _Traits::_Load(_Src));
+                _Acc1     = _Traits::_Add(_Acc1, _Traits::_Load(_Src + _Vec_size));
+                _Acc2     = _Traits::_Add(_Acc2, _Traits::_Load(_Src + _Vec_size * 2));
+                _Acc3     = _Traits::_Add(_Acc3, _Traits::_Load(_Src + _Vec_size * 3));
+                _Advance_bytes(_First, _Vec_size * 4);
+            } while (_First != _Stop_at);
+
+            _Advance_bytes(_Stop_at, _Size_bytes & (_Vec_size * 3));
+
+            for (; _First != _Stop_at; _Advance_bytes(_First, _Vec_size)) {
+                _Acc0 = _Traits::_Add(_Acc0, _Traits::_Load(_First));
+            }
+
+            return _Traits::_H_sum(_Traits::_Add(_Traits::_Add(_Acc0, _Acc1), _Traits::_Add(_Acc2, _Acc3)));
+        }
+
+        template <class _Traits>
+        typename _Traits::_Elem _Dot_product_impl(
+            const void*& _First1, const void* const _Last1, const void*& _First2) noexcept {
+            [[maybe_unused]] typename _Traits::_Guard _Guard; // TRANSITION, DevCom-10331414
+
+            constexpr size_t _Vec_size = _Traits::_Vec_size;
+            const size_t _Size_bytes   = _Byte_length(_First1, _Last1);
+
+            auto _Acc0 = _Traits::_Identity();
+            auto _Acc1 = _Acc0;
+            auto _Acc2 = _Acc0;
+            auto _Acc3 = _Acc0;
+
+            const void* _Stop_at = _First1;
+            _Advance_bytes(_Stop_at, _Size_bytes & ~(_Vec_size * 4 - 1));
+
+            do {
+                auto _Src1 = static_cast<const unsigned char*>(_First1);
+                auto _Src2 = static_cast<const unsigned char*>(_First2);
+                _Acc0 = _Traits::_Add(_Acc0, _Traits::_Mul(_Traits::_Load(_Src1), _Traits::_Load(_Src2)));
+                _Acc1 = _Traits::_Add(
+                    _Acc1, _Traits::_Mul(_Traits::_Load(_Src1 + _Vec_size), _Traits::_Load(_Src2 + _Vec_size)));
+                _Acc2 = _Traits::_Add(_Acc2,
+                    _Traits::_Mul(_Traits::_Load(_Src1 + _Vec_size * 2), _Traits::_Load(_Src2 + _Vec_size * 2)));
+                _Acc3 = _Traits::_Add(_Acc3,
+                    _Traits::_Mul(_Traits::_Load(_Src1 + _Vec_size * 3), _Traits::_Load(_Src2 + _Vec_size * 3)));
+                _Advance_bytes(_First1, _Vec_size * 4);
+                _Advance_bytes(_First2, _Vec_size * 4);
+            } while (_First1 != _Stop_at);
+
+            _Advance_bytes(_Stop_at, _Size_bytes & (_Vec_size * 3));
+
+            for (; _First1 != _Stop_at; _Advance_bytes(_First1, _Vec_size), _Advance_bytes(_First2, _Vec_size)) {
+                _Acc0 = _Traits::_Add(_Acc0, _Traits::_Mul(_Traits::_Load(_First1), _Traits::_Load(_First2)));
+            }
+
+            return _Traits::_H_sum(_Traits::_Add(_Traits::_Add(_Acc0, _Acc1), _Traits::_Add(_Acc2, _Acc3)));
+        }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+        template <class _Avx512, class _Avx, class _Sse, class _Ty>
+        _Ty _Reduce_plus_disp(const void* _First, const void* const _Last, _Ty _Result) noexcept {
+#ifndef _M_ARM64EC
+            const size_t _Size_bytes = _Byte_length(_First, _Last);
+            if (_Size_bytes >= 256 && _Use_avx512()) {
+                _Result += _Reducing::_Reduce_plus_impl<_Avx512>(_First, _Last);
+            } else if (_Size_bytes >= 128 && _Use_avx2()) {
+                _Result += _Reducing::_Reduce_plus_impl<_Avx>(_First, _Last);
+            } else if (_Size_bytes >= 64 && _Use_sse42()) {
+                _Result += _Reducing::_Reduce_plus_impl<_Sse>(_First, _Last);
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+            return _Reducing::_Reduce_plus_fallback(_First, _Last, _Result);
+        }
+
+        template <class _Avx512, class _Avx, class _Sse, class _Ty>
+        _Ty _Dot_product_disp(
+            const void* _First1, const void* const _Last1, const void* _First2, _Ty _Result) noexcept {
+#ifndef _M_ARM64EC
+            const size_t _Size_bytes = _Byte_length(_First1, _Last1);
+            if (_Size_bytes >= 256 && _Use_avx512()) {
+                _Result += _Reducing::_Dot_product_impl<_Avx512>(_First1, _Last1, _First2);
+            } else if (_Size_bytes >= 128 && _Use_avx2()) {
+                _Result += _Reducing::_Dot_product_impl<_Avx>(_First1, _Last1, _First2);
+            } else if (_Size_bytes >= 64 && _Use_sse42()) {
+                _Result += _Reducing::_Dot_product_impl<_Sse>(_First1, _Last1, _First2);
+            }
+#endif // ^^^ !defined(_M_ARM64EC) ^^^
+
+            return _Reducing::_Dot_product_fallback(_First1, _Last1, _First2, _Result);
+        }
+    } // namespace _Reducing
+} // unnamed namespace
+
+extern "C" {
+
+__declspec(noalias) uint32_t __stdcall __std_reduce_plus_4(const void* const _First, const void* const _Last) noexcept {
+    using namespace _Reducing;
+    return _Reduce_plus_disp<_Traits_4_avx512, _Traits_4_avx, _Traits_4_sse>(_First, _Last, uint32_t{0});
+}
+
+__declspec(noalias) uint64_t __stdcall __std_reduce_plus_8(const void* const _First, const void* const _Last) noexcept {
+    using namespace _Reducing;
+    return _Reduce_plus_disp<_Traits_8_avx512, _Traits_8_avx, _Traits_8_sse>(_First, _Last, uint64_t{0});
+}
+
+__declspec(noalias) float __stdcall __std_reduce_plus_f(const void* const _First, const void* const _Last) noexcept {
+    using namespace _Reducing;
+    return _Reduce_plus_disp<_Traits_f_avx512, _Traits_f_avx, _Traits_f_sse>(_First, _Last, -0.0f);
+}
+
+__declspec(noalias) double __stdcall __std_reduce_plus_d(const void* const _First, const void* const _Last) noexcept {
+    using namespace _Reducing;
+    return _Reduce_plus_disp<_Traits_d_avx512, _Traits_d_avx, _Traits_d_sse>(_First, _Last, -0.0);
+}
+
+__declspec(noalias) float __stdcall __std_dot_product_f(
+    const void* const _First1, const void* const _Last1, const void* const _First2) noexcept {
+    using namespace _Reducing;
+    return _Dot_product_disp<_Traits_f_avx512, _Traits_f_avx, _Traits_f_sse>(_First1, _Last1, _First2, -0.0f);
+}
+
+__declspec(noalias) double __stdcall __std_dot_product_d(
+    const void* const _First1, const void* const _Last1, const void* const _First2) noexcept {
+    using namespace _Reducing;
+    return _Dot_product_disp<_Traits_d_avx512, _Traits_d_avx, _Traits_d_sse>(_First1, _Last1, _First2, -0.0);
+}
+
+} // extern "C"
+
 namespace {
     namespace _Bitset_to_string {
 #ifdef _M_ARM64EC
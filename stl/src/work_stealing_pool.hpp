@@ -0,0 +1,205 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// portable work-stealing thread pool, usable in place of the Windows threadpool behind the
+// __std_*_threadpool_work entry points
+
+// This header only depends on the Standard Library, so the pool can be built and tested on its own, see
+// tests/std/tests/VSO_0000000_work_stealing_pool. A pool with no worker threads runs every callback on the thread
+// waiting for it, which is deterministic.
+
+#pragma once
+
+#include <yvals_core.h>
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+struct _Pool_work {
+    // a callback that can be submitted any number of times to a _Work_stealing_pool; as with PTP_WORK, each
+    // submission invokes _Invoke once, unless the submission is canceled by _Work_stealing_pool::_Wait first
+    using _Invoke_fn = void (*)(_Pool_work&) noexcept;
+
+    explicit _Pool_work(const _Invoke_fn _Invoke_) noexcept : _Invoke(_Invoke_) {}
+
+    _Pool_work(const _Pool_work&)            = delete;
+    _Pool_work& operator=(const _Pool_work&) = delete;
+
+    _Invoke_fn _Invoke;
+    _STD atomic<size_t> _Outstanding{0}; // submissions which are queued or running
+    _STD atomic<bool> _Canceled{false};
+};
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4324) // structure was padded due to alignment specifier
+#endif // defined(_MSC_VER)
+struct alignas(_STD hardware_destructive_interference_size) _Pool_queue {
+    // one worker's queue; the worker pops from the back, other threads steal from the front
+    _STD mutex _Lock;
+    _STD deque<_Pool_work*> _Items;
+};
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif // defined(_MSC_VER)
+
+class _Work_stealing_pool {
+public:
+    explicit _Work_stealing_pool(const size_t _Worker_count) : _Queues(_Worker_count == 0 ? 1 : _Worker_count) {
+        _Workers.reserve(_Worker_count);
+        try {
+            for (size_t _Idx = 0; _Idx < _Worker_count; ++_Idx) {
+                _Workers.emplace_back([this, _Idx] { _Worker_main(_Idx); });
+            }
+        } catch (...) {
+            // run with the workers we have; waiting threads drain the queues, so even no workers make progress
+        }
+    }
+
+    _Work_stealing_pool(const _Work_stealing_pool&)            = delete;
+    _Work_stealing_pool& operator=(const _Work_stealing_pool&) = delete;
+
+    ~_Work_stealing_pool() {
+        // all works must have been waited for
+        _Stopping.store(true);
+        _Work_epoch.fetch_add(1);
+        _Work_epoch.notify_all();
+        for (auto& _Worker : _Workers) {
+            _Worker.join();
+        }
+    }
+
+    void _Submit(_Pool_work& _Work, const size_t _Submissions) noexcept {
+        // queue _Submissions invocations of _Work, spread over the worker queues so that each worker starts with
+        // work of its own and only steals once its queue runs dry
+        if (_Submissions == 0) {
+            return;
+        }
+
+        _Work._Outstanding.fetch_add(_Submissions);
+        const size_t _Queue_count = _Queues.size();
+        size_t _Target            = _Next_queue.fetch_add(_Submissions);
+        for (size_t _Idx = 0; _Idx < _Submissions; ++_Idx, ++_Target) {
+            auto& _Queue = _Queues[_Target % _Queue_count];
+            _STD lock_guard<_STD mutex> _Guard{_Queue._Lock};
+            _Queue._Items.push_back(&_Work); // terminates on allocation failure
+        }
+
+        _Work_epoch.fetch_add(1);
+        if (_Sleeping.load() != 0) {
+            if (_Submissions == 1) {
+                _Work_epoch.notify_one();
+            } else {
+                _Work_epoch.notify_all();
+            }
+        }
+    }
+
+    void _Wait(_Pool_work& _Work, const bool _Cancel) noexcept {
+        // wait for all submissions of _Work to finish, dropping those which have not started if _Cancel;
+        // rather than block while callbacks are queued, the waiting thread runs them, including other works' ones
+        if (_Cancel) {
+            _Work._Canceled.store(true);
+        }
+
+        for (;;) {
+            const auto _Epoch = _Completion_epoch.load();
+            if (_Work._Outstanding.load() == 0) {
+                break;
+            }
+
+            if (!_Try_run_one(0)) {
+                _Completion_epoch.wait(_Epoch);
+            }
+        }
+
+        _Work._Canceled.store(false);
+    }
+
+private:
+    static constexpr int _Spin_count = 64;
+
+    bool _Try_run_one(const size_t _Home) noexcept {
+        // pop from the back of _Home's queue, or else steal from the front of another queue, and run it
+        const size_t _Queue_count = _Queues.size();
+        for (size_t _Offset = 0; _Offset < _Queue_count; ++_Offset) {
+            auto& _Queue = _Queues[(_Home + _Offset) % _Queue_count];
+            _Pool_work* _Work;
+            {
+                _STD lock_guard<_STD mutex> _Guard{_Queue._Lock};
+                if (_Queue._Items.empty()) {
+                    continue;
+                }
+
+                if (_Offset == 0) {
+                    _Work = _Queue._Items.back();
+                    _Queue._Items.pop_back();
+                } else {
+                    _Work = _Queue._Items.front();
+                    _Queue._Items.pop_front();
+                }
+            }
+
+            if (!_Work->_Canceled.load()) {
+                _Work->_Invoke(*_Work);
+            }
+
+            if (_Work->_Outstanding.fetch_sub(1) == 1) {
+                // *_Work may be destroyed as soon as a waiter observes zero, so waiters sleep on the pool instead
+                _Completion_epoch.fetch_add(1);
+                _Completion_epoch.notify_all();
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void _Worker_main(const size_t _Home) noexcept {
+        for (;;) {
+            if (_Try_run_one(_Home)) {
+                continue;
+            }
+
+            // parallel algorithms submit their work in bursts, so spin for a bit before going to sleep
+            bool _Found = false;
+            for (int _Spin = 0; _Spin < _Spin_count && !_Found; ++_Spin) {
+                _STD this_thread::yield();
+                _Found = _Try_run_one(_Home);
+            }
+
+            if (_Found) {
+                continue;
+            }
+
+            // announce that we are sleeping before the final check, so _Submit either sees _Sleeping or its work
+            // is found by that check
+            _Sleeping.fetch_add(1);
+            const auto _Epoch = _Work_epoch.load();
+            if (!_Try_run_one(_Home)) {
+                if (_Stopping.load()) {
+                    _Sleeping.fetch_sub(1);
+                    return;
+                }
+
+                _Work_epoch.wait(_Epoch);
+            }
+
+            _Sleeping.fetch_sub(1);
+        }
+    }
+
+    _STD vector<_Pool_queue> _Queues;
+    _STD atomic<size_t> _Next_queue{0};
+    _STD atomic<size_t> _Sleeping{0};
+    _STD atomic<unsigned int> _Work_epoch{0}; // changes whenever work is submitted or the pool stops
+    _STD atomic<unsigned int> _Completion_epoch{0}; // changes whenever some work's last submission finishes
+    _STD atomic<bool> _Stopping{false};
+    _STD vector<_STD thread> _Workers;
+};
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+template <class FwdIt, class T>
+FwdIt last_known_good_lower_bound(FwdIt first, FwdIt last, const T& val) {
+    for (; first != last; ++first) {
+        if (!(*first < val)) {
+            break;
+        }
+    }
+
+    return first;
+}
+
+template <class FwdIt, class T>
+FwdIt last_known_good_upper_bound(FwdIt first, FwdIt last, const T& val) {
+    for (; first != last; ++first) {
+        if (val < *first) {
+            break;
+        }
+    }
+
+    return first;
+}
+
+template <class T>
+void test_case_bounds(const std::vector<T>& input, const T val) {
+    const auto expected_lower = last_known_good_lower_bound(input.begin(), input.end(), val);
+    const auto expected_upper = last_known_good_upper_bound(input.begin(), input.end(), val);
+
+    assert(std::lower_bound(input.begin(), input.end(), val) == expected_lower);
+    assert(std::upper_bound(input.begin(), input.end(), val) == expected_upper);
+    assert(std::equal_range(input.begin(), input.end(), val) == std::make_pair(expected_lower, expected_upper));
+    assert(std::binary_search(input.begin(), input.end(), val) == (expected_lower != expected_upper));
+#if _HAS_CXX20
+    assert(std::ranges::lower_bound(input, val) == expected_lower);
+    assert(std::ranges::upper_bound(input, val) == expected_upper);
+
+    const auto actual_r = std::ranges::equal_range(input, val);
+    assert(actual_r.begin() == expected_lower);
+    assert(actual_r.end() == expected_upper);
+#endif // _HAS_CXX20
+}
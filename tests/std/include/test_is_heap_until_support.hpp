@@ -0,0 +1,41 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+template <class RanIt, class Comp>
+RanIt last_known_good_is_heap_until(RanIt first, RanIt last, Comp comp) {
+    const auto size = last - first;
+    for (decltype(last - first) child = 1; child < size; ++child) {
+        if (comp(first[(child - 1) / 2], first[child])) {
+            return first + child;
+        }
+    }
+
+    return last;
+}
+
+template <class T, class Comp>
+void test_case_is_heap_until(const std::vector<T>& input, Comp comp) {
+    auto expected = last_known_good_is_heap_until(input.begin(), input.end(), comp);
+    auto actual   = std::is_heap_until(input.begin(), input.end(), comp);
+    assert(expected == actual);
+    assert(std::is_heap(input.begin(), input.end(), comp) == (expected == input.end()));
+#if _HAS_CXX20
+    auto actual_r = std::ranges::is_heap_until(input, comp);
+    assert(expected == actual_r);
+#endif // _HAS_CXX20
+}
+
+template <class T, class Comp>
+void test_is_heap_until_with_prefix_heap(std::vector<T> input, const std::ptrdiff_t heap_size, Comp comp) {
+    // A heap prefix followed by unordered elements, so that the mismatch is at an arbitrary position
+    std::make_heap(input.begin(), input.begin() + heap_size, comp);
+    test_case_is_heap_until(input, comp);
+    assert(std::is_heap(input.begin(), input.begin() + heap_size, comp));
+}
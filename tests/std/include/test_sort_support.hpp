@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+template <class T, class Comp>
+void last_known_good_merge_sort(T* first, T* last, T* buf, Comp comp) {
+    const std::ptrdiff_t count = last - first;
+    if (count < 2) {
+        return;
+    }
+
+    T* const mid = first + count / 2;
+    last_known_good_merge_sort(first, mid, buf, comp);
+    last_known_good_merge_sort(mid, last, buf, comp);
+
+    T* left  = first;
+    T* right = mid;
+    T* out   = buf;
+    while (left != mid && right != last) {
+        if (comp(*right, *left)) {
+            *out++ = *right++;
+        } else {
+            *out++ = *left++;
+        }
+    }
+
+    out = std::copy(left, mid, out);
+    out = std::copy(right, last, out);
+    std::copy(buf, out, first);
+}
+
+template <class T, class Comp>
+std::vector<T> last_known_good_sort(std::vector<T> v, Comp comp) {
+    std::vector<T> buf(v.size());
+    last_known_good_merge_sort(v.data(), v.data() + v.size(), buf.data(), comp);
+    return v;
+}
+
+template <class T, class Comp>
+void test_case_sort(const std::vector<T>& input, Comp comp) {
+    const auto expected = last_known_good_sort(input, comp);
+
+    auto actual = input;
+    std::sort(actual.begin(), actual.end(), comp);
+    assert(expected == actual);
+
+    auto actual_stable = input;
+    std::stable_sort(actual_stable.begin(), actual_stable.end(), comp);
+    assert(expected == actual_stable);
+#if _HAS_CXX20
+    auto actual_r = input;
+    std::ranges::sort(actual_r, comp);
+    assert(expected == actual_r);
+
+    auto actual_stable_r = input;
+    std::ranges::stable_sort(actual_stable_r, comp);
+    assert(expected == actual_stable_r);
+#endif // _HAS_CXX20
+}
+
+template <class T, class Comp>
+void assert_nth_element(
+    const std::vector<T>& expected, const std::vector<T>& actual, const std::size_t nth, Comp comp) {
+    assert(expected[nth] == actual[nth]);
+    for (std::size_t i = 0; i != nth; ++i) {
+        assert(!comp(actual[nth], actual[i]));
+    }
+
+    for (std::size_t i = nth + 1; i != actual.size(); ++i) {
+        assert(!comp(actual[i], actual[nth]));
+    }
+
+    assert(last_known_good_sort(actual, comp) == expected);
+}
+
+template <class T, class Comp>
+void test_case_nth_element(const std::vector<T>& input, const std::size_t nth, Comp comp) {
+    const auto expected = last_known_good_sort(input, comp);
+
+    auto actual = input;
+    std::nth_element(actual.begin(), actual.begin() + static_cast<std::ptrdiff_t>(nth), actual.end(), comp);
+    assert_nth_element(expected, actual, nth, comp);
+#if _HAS_CXX20
+    auto actual_r = input;
+    std::ranges::nth_element(actual_r, actual_r.begin() + static_cast<std::ptrdiff_t>(nth), comp);
+    assert_nth_element(expected, actual_r, nth, comp);
+#endif // _HAS_CXX20
+}
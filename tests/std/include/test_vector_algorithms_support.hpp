@@ -55,6 +55,9 @@ void run_randomized_tests_with_different_isa_levels(TestFunc tests) {
     tests(gen);
 
 #if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_CEE_PURE)
+    disable_instructions(__ISA_AVAILABLE_AVX512);
+    tests(gen);
+
     disable_instructions(__ISA_AVAILABLE_AVX2);
     tests(gen);
 
@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto is_odd  = [](unsigned int i) { return (i & 0x1u) != 0; };
+const auto is_even = [](unsigned int i) { return (i & 0x1u) == 0; };
+
+template <template <class...> class Container>
+void test_case_copy_if_family_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> input(testSize);
+    vector<unsigned int> expected(testSize);
+    vector<unsigned int> actual(testSize);
+
+    // copy everything, then nothing:
+    iota(input.begin(), input.end(), 0U);
+    auto actualEnd = copy_if(par, input.begin(), input.end(), actual.begin(), [](unsigned int) { return true; });
+    assert(actualEnd == actual.end());
+    assert(equal(input.begin(), input.end(), actual.begin()));
+    actualEnd = remove_copy_if(par, input.begin(), input.end(), actual.begin(), [](unsigned int) { return true; });
+    assert(actualEnd == actual.begin());
+
+    // "fuzz" testing:
+    uniform_int_distribution<unsigned int> dis(0, 7);
+    for (int i = 0; i < 100; ++i) {
+        generate(input.begin(), input.end(), [&] { return dis(gen); });
+
+        auto expectedEnd = copy_if(input.begin(), input.end(), expected.begin(), is_odd);
+        actualEnd        = copy_if(par, input.begin(), input.end(), actual.begin(), is_odd);
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+        expectedEnd = remove_copy_if(input.begin(), input.end(), expected.begin(), is_odd);
+        actualEnd   = remove_copy_if(par, input.begin(), input.end(), actual.begin(), is_odd);
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+        assert(all_of(actual.begin(), actualEnd, is_even));
+
+        expectedEnd = remove_copy(input.begin(), input.end(), expected.begin(), 3U);
+        actualEnd   = remove_copy(par, input.begin(), input.end(), actual.begin(), 3U);
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+        actualEnd = remove_copy(seq, input.begin(), input.end(), actual.begin(), 3U);
+        assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_copy_if_family_parallel<forward_list>, gen);
+    parallel_test_case(test_case_copy_if_family_parallel<list>, gen);
+    parallel_test_case(test_case_copy_if_family_parallel<vector>, gen);
+}
@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// tests the non-standard par.with_deterministic_reduction() execution policy adaptor
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <execution>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+constexpr auto deterministic_policy = par.with_deterministic_reduction();
+constexpr auto one_thread_policy    = par.with_max_threads(1).with_deterministic_reduction();
+constexpr auto two_threads_policy   = par_unseq.with_deterministic_reduction().with_max_threads(2);
+
+static_assert(is_execution_policy_v<remove_const_t<decltype(deterministic_policy)>>);
+static_assert(is_execution_policy_v<remove_const_t<decltype(one_thread_policy)>>);
+static_assert(is_execution_policy_v<remove_const_t<decltype(two_threads_policy)>>);
+
+// large enough that reductions and scans are split into several chunks, see std::_Deterministic_chunk_size
+const size_t deterministic_test_size = (1 << 18) + 7;
+
+template <class T>
+bool same_bits(const T& lhs, const T& rhs) {
+    return memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+
+template <class T>
+bool same_bits(const vector<T>& lhs, const vector<T>& rhs) {
+    return lhs.size() == rhs.size() && (lhs.empty() || memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0);
+}
+
+struct results {
+    float reduced;
+    double transform_reduced;
+    double transform_reduced_binary;
+    vector<float> exclusive;
+    vector<float> inclusive;
+    vector<float> transform_exclusive;
+    vector<float> transform_inclusive;
+};
+
+template <class ExPo, class FwdIt>
+results run_all(const ExPo& policy, const FwdIt first, const FwdIt last, const vector<float>& other) {
+    const auto size = static_cast<size_t>(distance(first, last));
+    const auto half = [](float x) { return x * 0.5f; };
+    results r{};
+    r.reduced           = reduce(policy, first, last, 0.25f);
+    r.transform_reduced = transform_reduce(policy, first, last, 1.0, plus<>{}, [](float x) { return x / 3.0; });
+    r.transform_reduced_binary =
+        transform_reduce(policy, first, last, other.begin(), 0.0, plus<>{}, multiplies<double>{});
+    r.exclusive.resize(size);
+    r.inclusive.resize(size);
+    r.transform_exclusive.resize(size);
+    r.transform_inclusive.resize(size);
+    exclusive_scan(policy, first, last, r.exclusive.begin(), 0.5f);
+    inclusive_scan(policy, first, last, r.inclusive.begin());
+    transform_exclusive_scan(policy, first, last, r.transform_exclusive.begin(), 0.5f, plus<>{}, half);
+    transform_inclusive_scan(policy, first, last, r.transform_inclusive.begin(), plus<>{}, half, 0.5f);
+    return r;
+}
+
+void assert_same_bits(const results& lhs, const results& rhs) {
+    assert(same_bits(lhs.reduced, rhs.reduced));
+    assert(same_bits(lhs.transform_reduced, rhs.transform_reduced));
+    assert(same_bits(lhs.transform_reduced_binary, rhs.transform_reduced_binary));
+    assert(same_bits(lhs.exclusive, rhs.exclusive));
+    assert(same_bits(lhs.inclusive, rhs.inclusive));
+    assert(same_bits(lhs.transform_exclusive, rhs.transform_exclusive));
+    assert(same_bits(lhs.transform_inclusive, rhs.transform_inclusive));
+}
+
+void test_case_reproducible(const size_t testSize, mt19937& gen) {
+    // widely varying magnitudes, so that any change in how the elements are grouped changes the results
+    uniform_real_distribution<float> mantissa(-1.0f, 1.0f);
+    uniform_int_distribution<int> exponent(-20, 20);
+    vector<float> v(testSize);
+    vector<float> other(testSize);
+    for (auto& x : v) {
+        x = ldexp(mantissa(gen), exponent(gen));
+    }
+
+    for (auto& x : other) {
+        x = mantissa(gen);
+    }
+
+    const list<float> l(v.begin(), v.end());
+    const auto expected = run_all(deterministic_policy, v.begin(), v.end(), other);
+    for (int rep = 0; rep < 4; ++rep) {
+        assert_same_bits(run_all(deterministic_policy, v.begin(), v.end(), other), expected);
+        assert_same_bits(run_all(one_thread_policy, v.begin(), v.end(), other), expected);
+        assert_same_bits(run_all(two_threads_policy, v.begin(), v.end(), other), expected);
+    }
+
+    assert_same_bits(run_all(deterministic_policy, l.begin(), l.end(), other), expected);
+    assert_same_bits(run_all(one_thread_policy, l.begin(), l.end(), other), expected);
+
+    // the results are still sums of the input, up to rounding
+    const double exact     = accumulate(v.begin(), v.end(), 0.25);
+    const double magnitude = accumulate(v.begin(), v.end(), 0.0, [](double sum, float x) { return sum + fabs(x); });
+    const double tolerance = magnitude * 1e-3 + 1e-3;
+    assert(fabs(expected.reduced - exact) <= tolerance);
+    if (testSize != 0) {
+        assert(fabs(expected.inclusive.back() - (exact - 0.25)) <= tolerance);
+        assert(fabs(expected.exclusive.back() - (exact - 0.25 + 0.5 - v.back())) <= tolerance);
+    }
+}
+
+void test_case_exact(const size_t testSize) {
+    // with exact arithmetic, the results match the serial algorithms
+    vector<long long> v(testSize);
+    iota(v.begin(), v.end(), 1LL);
+    const auto n = static_cast<long long>(testSize);
+    assert(reduce(deterministic_policy, v.begin(), v.end(), 3LL) == 3 + n * (n + 1) / 2);
+    assert(transform_reduce(two_threads_policy, v.begin(), v.end(), 0LL, plus<>{}, negate<>{}) == -n * (n + 1) / 2);
+    assert(transform_reduce(one_thread_policy, v.begin(), v.end(), v.begin(), 0LL, plus<>{}, minus<>{}) == 0);
+
+    vector<long long> expected(testSize);
+    vector<long long> actual(testSize);
+    partial_sum(v.begin(), v.end(), expected.begin());
+    inclusive_scan(deterministic_policy, v.begin(), v.end(), actual.begin());
+    assert(actual == expected);
+    exclusive_scan(v.begin(), v.end(), expected.begin(), 7LL);
+    exclusive_scan(two_threads_policy, v.begin(), v.end(), actual.begin(), 7LL);
+    assert(actual == expected);
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_reproducible, gen);
+    parallel_test_case(test_case_exact);
+    test_case_reproducible(deterministic_test_size, gen);
+    test_case_exact(deterministic_test_size);
+}
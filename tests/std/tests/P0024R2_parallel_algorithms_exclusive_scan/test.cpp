@@ -17,6 +17,9 @@
 using namespace std;
 using namespace std::execution;
 
+// large enough that many chunks are reduced before their predecessors' sums are known, see std::_Get_scan_chunk_count
+const size_t scan_test_size = (1 << 20) + 3;
+
 bool starts_with(const string_view target, const string_view test) {
     return target.substr(0, test.size()) == test;
 }
@@ -203,4 +206,7 @@ int main() {
     parallel_test_case(test_case_exclusive_scan_bop_parallel_associative);
     parallel_test_case(test_case_exclusive_scan_bop_parallel_associative_in_place);
     test_case_exclusive_scan_init_writes_intermediate_type();
+
+    test_case_exclusive_scan_parallel(scan_test_size, gen);
+    test_case_exclusive_scan_bop_parallel(scan_test_size, gen);
 }
@@ -76,6 +76,9 @@ int main() {
     parallel_test_case(test_case_for_each_n_parallel<forward_list>{}, par);
     parallel_test_case(test_case_for_each_n_parallel<list>{}, par);
     parallel_test_case(test_case_for_each_n_parallel<vector>{}, par);
+    // many more elements than chunks, so guided chunks shrink over many claims
+    test_case_for_each_parallel<vector>{}(100'000, par);
+    test_case_for_each_n_parallel<vector>{}(100'000, par);
 #if _HAS_CXX20
     parallel_test_case(test_case_for_each_parallel<forward_list>{}, unseq);
     parallel_test_case(test_case_for_each_parallel<list>{}, unseq);
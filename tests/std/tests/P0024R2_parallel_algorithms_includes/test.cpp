@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <execution>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+template <class T>
+void assert_message_vector(const bool b, const char* const msg, const T seedValue) {
+    if (!b) {
+        cerr << msg << " failed for seed value: " << seedValue << "\n";
+        cerr << "This is a randomized test.\n";
+        cerr << "DO NOT IGNORE/RERUN THIS FAILURE.\n";
+        cerr << "You must report it to the STL maintainers.\n";
+        abort();
+    }
+}
+
+void test_case_includes_parallel(const size_t testSize) {
+    vector<int> all(testSize);
+    iota(all.begin(), all.end(), 0);
+    vector<int> evens;
+    for (size_t i = 0; i < testSize; i += 2) {
+        evens.push_back(static_cast<int>(i));
+    }
+
+    // === Subsets, supersets and the empty set ===
+    assert(includes(par, all.begin(), all.end(), all.begin(), all.end()));
+    assert(includes(par, all.begin(), all.end(), evens.begin(), evens.end()));
+    assert(includes(par, all.begin(), all.end(), evens.begin(), evens.begin()));
+    assert(includes(par, evens.begin(), evens.end(), all.begin(), all.end()) == (testSize < 2));
+
+    // === Each single element missing ===
+    auto remainingAttempts = quadratic_complexity_case_limit;
+    for (size_t missing = 0; missing < testSize; ++missing) {
+        vector<int> withHole(all);
+        withHole.erase(withHole.begin() + static_cast<ptrdiff_t>(missing));
+        assert(!includes(par, withHole.begin(), withHole.end(), all.begin(), all.end()));
+        assert(!includes(par, withHole.begin(), withHole.end(), evens.begin(), evens.end()) == (missing % 2 == 0));
+        if (--remainingAttempts == 0) {
+            break;
+        }
+    }
+
+    // === Equivalent elements must be present at least as many times ===
+    vector<int> ones(testSize, 1);
+    vector<int> fewerOnes(testSize / 2, 1);
+    assert(includes(par, ones.begin(), ones.end(), fewerOnes.begin(), fewerOnes.end()));
+    assert(includes(par, fewerOnes.begin(), fewerOnes.end(), ones.begin(), ones.end()) == (testSize == 0));
+
+    // === Decreasing ranges ===
+    reverse(all.begin(), all.end());
+    reverse(evens.begin(), evens.end());
+    assert(includes(par, all.begin(), all.end(), evens.begin(), evens.end(), greater<>{}));
+
+    // test randomized input ranges
+    const auto seedValue = random_device{}();
+    mt19937 gen(seedValue);
+    for (const int maxKey : {4, static_cast<int>(testSize)}) {
+        uniform_int_distribution<int> dis(0, maxKey);
+        vector<int> list1(testSize);
+        for (auto& elem : list1) {
+            elem = dis(gen);
+        }
+
+        sort(list1.begin(), list1.end());
+        vector<int> list2;
+        for (const auto& elem : list1) {
+            if (gen() % 4 == 0) {
+                list2.push_back(elem);
+            }
+        }
+
+        assert_message_vector(includes(par, list1.begin(), list1.end(), list2.begin(), list2.end()),
+            "Randomized vectors, includes subset", seedValue);
+
+        list2.push_back(dis(gen));
+        sort(list2.begin(), list2.end());
+        assert_message_vector(includes(par, list1.begin(), list1.end(), list2.begin(), list2.end())
+                                  == includes(list1.begin(), list1.end(), list2.begin(), list2.end()),
+            "Randomized vectors, includes extra element", seedValue);
+    }
+}
+
+int main() {
+    parallel_test_case(test_case_includes_parallel);
+}
@@ -0,0 +1,150 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// tests the non-standard par.with_grain() and par.with_max_threads() execution policy adaptors
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <list>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+constexpr auto grain_policy   = par.with_grain(1000);
+constexpr auto limited_policy = par.with_max_threads(2);
+constexpr auto both_policy    = par_unseq.with_grain(64).with_max_threads(3);
+
+static_assert(is_execution_policy_v<remove_const_t<decltype(grain_policy)>>);
+static_assert(is_execution_policy_v<remove_const_t<decltype(limited_policy)>>);
+static_assert(is_execution_policy_v<remove_const_t<decltype(both_policy)>>);
+
+// counts how many threads run an element access function at once
+struct concurrency_meter {
+    atomic<size_t> active{0};
+    atomic<size_t> most_active{0};
+
+    void enter() {
+        const size_t now = active.fetch_add(1) + 1;
+        size_t seen      = most_active.load();
+        while (seen < now && !most_active.compare_exchange_weak(seen, now)) {
+        }
+    }
+
+    void leave() {
+        active.fetch_sub(1);
+    }
+};
+
+template <class ExPo>
+void test_case_for_each_transform(const size_t testSize, const ExPo& policy) {
+    vector<int> v(testSize);
+    iota(v.begin(), v.end(), 0);
+    for_each(policy, v.begin(), v.end(), [](int& x) { x *= 2; });
+    for (size_t i = 0; i < testSize; ++i) {
+        assert(v[i] == static_cast<int>(i * 2));
+    }
+
+    const auto mid = v.begin() + static_cast<ptrdiff_t>(testSize / 2);
+    assert(for_each_n(policy, v.begin(), mid - v.begin(), [](int& x) { x = -1; }) == mid);
+    assert(all_of(v.begin(), mid, [](int x) { return x == -1; }));
+
+    list<int> l(testSize, 1);
+    for_each(policy, l.begin(), l.end(), [](int& x) { ++x; });
+    assert(all_of(l.begin(), l.end(), [](int x) { return x == 2; }));
+
+    vector<long long> out(testSize + 1, -1);
+    assert(transform(policy, v.begin(), v.end(), out.begin(), [](int x) { return x + 1LL; }) == out.end() - 1);
+    assert(transform(policy, v.begin(), v.end(), v.begin(), out.begin(), [](int x, int y) { return x + y + 0LL; })
+           == out.end() - 1);
+    for (size_t i = 0; i < testSize; ++i) {
+        assert(out[i] == v[i] * 2LL);
+    }
+    assert(out.back() == -1);
+}
+
+template <class ExPo>
+void test_case_reduce(const size_t testSize, const ExPo& policy) {
+    vector<long long> v(testSize);
+    iota(v.begin(), v.end(), 1LL);
+    const auto n        = static_cast<long long>(testSize);
+    const auto expected = n * (n + 1) / 2;
+    assert(reduce(policy, v.begin(), v.end(), 0LL, plus<>{}) == expected);
+    assert(transform_reduce(policy, v.begin(), v.end(), 5LL, plus<>{}, [](long long x) { return x * 2; })
+           == 5 + expected * 2);
+    assert(transform_reduce(policy, v.begin(), v.end(), v.begin(), 0LL, plus<>{}, minus<>{}) == 0);
+}
+
+template <class ExPo>
+void test_case_other_algorithms(const size_t testSize, const ExPo& policy) {
+    vector<int> v(testSize);
+    iota(v.rbegin(), v.rend(), 0);
+    assert(all_of(policy, v.begin(), v.end(), [](int x) { return x >= 0; }));
+    assert(find(policy, v.begin(), v.end(), 0) == (testSize == 0 ? v.end() : v.end() - 1));
+    sort(policy, v.begin(), v.end());
+    assert(is_sorted(v.begin(), v.end()));
+    stable_sort(policy, v.begin(), v.end(), greater<>{});
+    assert(is_sorted(policy, v.begin(), v.end(), greater<>{}));
+    vector<int> scanned(testSize);
+    inclusive_scan(policy, v.begin(), v.end(), scanned.begin());
+    vector<int> expected(testSize);
+    partial_sum(v.begin(), v.end(), expected.begin());
+    assert(scanned == expected);
+}
+
+template <class ExPo>
+void test_max_threads(const ExPo& policy, const size_t maxThreads) {
+    // the element access functions can't run on more threads at once than the policy allows
+    concurrency_meter meter;
+    vector<int> v(100'000);
+    for_each(policy, v.begin(), v.end(), [&](int& x) {
+        meter.enter();
+        x = 1;
+        meter.leave();
+    });
+    assert(meter.most_active.load() <= maxThreads);
+    assert(count(v.begin(), v.end(), 1) == 100'000);
+
+    iota(v.rbegin(), v.rend(), 0);
+    sort(policy, v.begin(), v.end(), [&](int lhs, int rhs) {
+        meter.enter();
+        const bool result = lhs < rhs;
+        meter.leave();
+        return result;
+    });
+    assert(meter.most_active.load() <= maxThreads);
+    assert(is_sorted(v.begin(), v.end()));
+}
+
+int main() {
+    parallel_test_case(test_case_for_each_transform<decltype(grain_policy)>, grain_policy);
+    parallel_test_case(test_case_for_each_transform<decltype(limited_policy)>, limited_policy);
+    parallel_test_case(test_case_for_each_transform<decltype(both_policy)>, both_policy);
+    parallel_test_case(test_case_reduce<decltype(grain_policy)>, grain_policy);
+    parallel_test_case(test_case_reduce<decltype(both_policy)>, both_policy);
+    parallel_test_case(test_case_other_algorithms<decltype(limited_policy)>, limited_policy);
+    parallel_test_case(test_case_other_algorithms<decltype(both_policy)>, both_policy);
+
+    // grains larger than the input run serially; a grain of 0 is treated as 1
+    test_case_for_each_transform(5000, par.with_grain(100'000));
+    test_case_reduce(5000, par.with_grain(100'000));
+    test_case_reduce(5000, par.with_grain(0));
+
+    test_max_threads(par.with_max_threads(1), 1);
+    test_max_threads(limited_policy, 2);
+    test_max_threads(both_policy, 3);
+
+    // limits at or above the hardware thread count are honored too
+    const size_t hwThreads = (max) (thread::hardware_concurrency(), 1u);
+    test_max_threads(par.with_max_threads(hwThreads), hwThreads);
+    test_max_threads(par.with_max_threads(hwThreads + 1), hwThreads + 1);
+}
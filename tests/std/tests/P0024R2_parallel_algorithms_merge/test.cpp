@@ -0,0 +1,182 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <execution>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// elements remember which input they came from, so that stability is observable
+using tagged = pair<int, size_t>;
+
+struct less_key {
+    bool operator()(const tagged& lhs, const tagged& rhs) const {
+        return lhs.first < rhs.first;
+    }
+};
+
+template <class T>
+void assert_message_vector(const bool b, const char* const msg, const T seedValue) {
+    if (!b) {
+        cerr << msg << " failed for seed value: " << seedValue << "\n";
+        cerr << "This is a randomized test.\n";
+        cerr << "DO NOT IGNORE/RERUN THIS FAILURE.\n";
+        cerr << "You must report it to the STL maintainers.\n";
+        abort();
+    }
+}
+
+vector<tagged> make_sorted_tagged(mt19937& gen, const size_t count, const int maxKey, const size_t firstTag) {
+    uniform_int_distribution<int> dis(0, maxKey);
+    vector<tagged> result(count);
+    for (size_t i = 0; i < count; ++i) {
+        result[i] = {dis(gen), firstTag + i};
+    }
+
+    stable_sort(result.begin(), result.end(), less_key{});
+    return result;
+}
+
+template <class ExecutionPolicy>
+void test_merge_split(const ExecutionPolicy& exec, const vector<tagged>& left, const vector<tagged>& right,
+    const unsigned int seedValue) {
+    vector<tagged> expected(left.size() + right.size());
+    merge(left.begin(), left.end(), right.begin(), right.end(), expected.begin(), less_key{});
+
+    vector<tagged> actual(expected.size());
+    const auto actualEnd =
+        merge(exec, left.begin(), left.end(), right.begin(), right.end(), actual.begin(), less_key{});
+    assert(actualEnd == actual.end());
+    assert_message_vector(actual == expected, "merge", seedValue);
+
+    actual = left;
+    actual.insert(actual.end(), right.begin(), right.end());
+    inplace_merge(exec, actual.begin(), actual.begin() + static_cast<ptrdiff_t>(left.size()), actual.end(), less_key{});
+    assert_message_vector(actual == expected, "inplace_merge", seedValue);
+}
+
+void test_case_merge_parallel(const size_t testSize) {
+    {
+        // === Default comparison and greater ===
+        vector<int> evens;
+        vector<int> odds;
+        for (size_t i = 0; i < testSize; ++i) {
+            (i % 2 == 0 ? evens : odds).push_back(static_cast<int>(i));
+        }
+
+        vector<int> expected(testSize);
+        iota(expected.begin(), expected.end(), 0);
+
+        vector<int> actual(testSize);
+        assert(merge(par, evens.begin(), evens.end(), odds.begin(), odds.end(), actual.begin()) == actual.end());
+        assert(actual == expected);
+
+        actual = evens;
+        actual.insert(actual.end(), odds.begin(), odds.end());
+        inplace_merge(par, actual.begin(), actual.begin() + static_cast<ptrdiff_t>(evens.size()), actual.end());
+        assert(actual == expected);
+
+        reverse(evens.begin(), evens.end());
+        reverse(odds.begin(), odds.end());
+        reverse(expected.begin(), expected.end());
+        assert(merge(par, odds.begin(), odds.end(), evens.begin(), evens.end(), actual.begin(), greater<>{})
+               == actual.end());
+        assert(actual == expected);
+
+        actual = odds;
+        actual.insert(actual.end(), evens.begin(), evens.end());
+        inplace_merge(
+            par, actual.begin(), actual.begin() + static_cast<ptrdiff_t>(odds.size()), actual.end(), greater<>{});
+        assert(actual == expected);
+    }
+
+    const auto seedValue = random_device{}();
+    mt19937 gen(seedValue);
+
+    // === Every split point, with many and with few equivalent elements ===
+    auto remainingAttempts = quadratic_complexity_case_limit;
+    for (size_t leftSize = 0; leftSize <= testSize; ++leftSize) {
+        for (const int maxKey : {2, static_cast<int>(testSize)}) {
+            const auto left  = make_sorted_tagged(gen, leftSize, maxKey, 0);
+            const auto right = make_sorted_tagged(gen, testSize - leftSize, maxKey, leftSize);
+            test_merge_split(par, left, right, seedValue);
+            test_merge_split(par_unseq, left, right, seedValue);
+        }
+
+        if (--remainingAttempts == 0) {
+            break;
+        }
+    }
+
+    // === All of one input before the other ===
+    {
+        const auto half = make_sorted_tagged(gen, testSize / 2, 0, 0);
+        auto high       = make_sorted_tagged(gen, testSize - testSize / 2, 0, testSize / 2);
+        for (auto& elem : high) {
+            elem.first = 1;
+        }
+
+        test_merge_split(par, half, high, seedValue);
+        test_merge_split(par, high, half, seedValue);
+    }
+
+    // === Predicates taking their arguments by value must not move from the inputs ===
+    {
+        vector<string> left;
+        vector<string> right;
+        for (size_t i = 0; i < testSize; ++i) {
+            // long enough to defeat the small string optimization, so that moving from a string empties it
+            (i % 3 == 0 ? left : right).push_back(string(32, 'a') + to_string(1000000 + i));
+        }
+
+        vector<string> expected = left;
+        expected.insert(expected.end(), right.begin(), right.end());
+        sort(expected.begin(), expected.end());
+
+        const auto byValueLess = [](string lhs, string rhs) { return lhs < rhs; };
+        vector<string> actual(testSize);
+        merge(par, left.begin(), left.end(), right.begin(), right.end(), actual.begin(), byValueLess);
+        assert(actual == expected);
+
+        actual = left;
+        actual.insert(actual.end(), right.begin(), right.end());
+        inplace_merge(par, actual.begin(), actual.begin() + static_cast<ptrdiff_t>(left.size()), actual.end(),
+            byValueLess);
+        assert(actual == expected);
+    }
+
+    // === Bidirectional iterators use the serial algorithm ===
+    {
+        vector<int> input(testSize);
+        for (auto& elem : input) {
+            elem = static_cast<int>(gen() % 16);
+        }
+
+        const auto split = static_cast<ptrdiff_t>(testSize / 3);
+        sort(input.begin(), input.begin() + split);
+        sort(input.begin() + split, input.end());
+        list<int> lst(input.begin(), input.end());
+        sort(input.begin(), input.end());
+
+        inplace_merge(par, lst.begin(), next(lst.begin(), split), lst.end());
+        assert(equal(lst.begin(), lst.end(), input.begin(), input.end()));
+    }
+}
+
+int main() {
+    parallel_test_case(test_case_merge_parallel);
+}
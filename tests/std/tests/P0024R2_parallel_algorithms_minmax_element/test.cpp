@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <forward_list>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// large enough that minmax_element splits the range into several chunks, see std::_Bandwidth_bound_chunk_min_bytes
+const size_t bandwidth_bound_test_size = 1 << 20;
+
+const auto compare_halves = [](int lhs, int rhs) { return lhs / 2 < rhs / 2; };
+
+template <template <class...> class Container>
+void test_case_minmax_element_parallel(const size_t testSize, mt19937& gen) {
+    // small value range so there are many equivalent elements, checking the first minimum and the last maximum
+    // are found like the serial algorithm does
+    uniform_int_distribution<int> dist(0, 7);
+    Container<int> c(testSize);
+    generate(c.begin(), c.end(), [&] { return dist(gen); });
+
+    assert(minmax_element(par, c.begin(), c.end()) == minmax_element(c.begin(), c.end()));
+    assert(
+        minmax_element(par, c.begin(), c.end(), compare_halves) == minmax_element(c.begin(), c.end(), compare_halves));
+}
+
+void test_case_minmax_element_large(mt19937& gen) {
+    uniform_int_distribution<int> dist(-1000, 1000);
+    vector<int> v(bandwidth_bound_test_size);
+    generate(v.begin(), v.end(), [&] { return dist(gen); });
+    assert(minmax_element(par, v.begin(), v.end()) == minmax_element(v.begin(), v.end()));
+    assert(
+        minmax_element(par, v.begin(), v.end(), compare_halves) == minmax_element(v.begin(), v.end(), compare_halves));
+
+    // unique extremes in the first and last chunks
+    v.front() = 5000;
+    v.back()  = -5000;
+    const auto result = minmax_element(par, v.begin(), v.end());
+    assert(result.first == v.end() - 1);
+    assert(result.second == v.begin());
+
+    fill(v.begin(), v.end(), 42);
+    assert(minmax_element(par, v.begin(), v.end()) == make_pair(v.begin(), v.end() - 1));
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_minmax_element_parallel<forward_list>, gen);
+    parallel_test_case(test_case_minmax_element_parallel<list>, gen);
+    parallel_test_case(test_case_minmax_element_parallel<vector>, gen);
+    test_case_minmax_element_large(gen);
+}
@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <execution>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// large enough for several rounds of parallel partitioning before the serial algorithm takes over
+const size_t large_test_sizes[] = {16384, 100000, 1000003};
+
+void assert_message(const bool b, const char* const msg, const unsigned int seedValue) {
+    if (!b) {
+        cerr << msg << " failed for seed value: " << seedValue << "\n";
+        cerr << "This is a randomized test.\n";
+        cerr << "DO NOT IGNORE/RERUN THIS FAILURE.\n";
+        cerr << "You must report it to the STL maintainers.\n";
+        abort();
+    }
+}
+
+template <class Pr>
+void check_nth_element(vector<int> c, const vector<int>& sorted, const size_t nth, Pr pred, const unsigned int seed) {
+    const auto nthIt = c.begin() + static_cast<ptrdiff_t>(nth);
+    nth_element(par, c.begin(), nthIt, c.end(), pred);
+    if (nthIt != c.end()) {
+        assert_message(*nthIt == sorted[nth], "nth_element value", seed);
+        assert_message(
+            none_of(c.begin(), nthIt, [&](int val) { return pred(*nthIt, val); }), "nth_element lower", seed);
+        assert_message(none_of(nthIt, c.end(), [&](int val) { return pred(val, *nthIt); }), "nth_element upper", seed);
+    }
+
+    sort(c.begin(), c.end(), pred);
+    assert_message(c == sorted, "nth_element permutation", seed);
+}
+
+void test_case_nth_element_parallel(const size_t testSize, mt19937& gen, const unsigned int seed) {
+    for (const int maxValue : {3, 1000000}) {
+        vector<int> c(testSize);
+        uniform_int_distribution<int> dis(0, maxValue);
+        generate(c.begin(), c.end(), [&] { return dis(gen); });
+        vector<int> sorted = c;
+        sort(sorted.begin(), sorted.end());
+
+        const size_t nths[] = {0, testSize / 3, testSize / 2, testSize - testSize / 4, testSize - 1, testSize};
+        for (const size_t nth : nths) {
+            if (nth <= testSize) {
+                check_nth_element(c, sorted, nth, less<>{}, seed);
+                check_nth_element(sorted, sorted, nth, less<>{}, seed);
+            }
+        }
+
+        // the default comparison and greater, on input that starts out sorted both ways
+        vector<int> reversed(sorted.rbegin(), sorted.rend());
+        const size_t nth = testSize / 2;
+        if (nth < testSize) {
+            vector<int> d = reversed;
+            nth_element(par, d.begin(), d.begin() + static_cast<ptrdiff_t>(nth), d.end());
+            assert_message(d[nth] == sorted[nth], "nth_element default comparison", seed);
+            check_nth_element(sorted, reversed, nth, greater<>{}, seed);
+        }
+    }
+}
+
+int main() {
+    random_device rd;
+    const unsigned int seed = rd();
+    mt19937 gen(seed);
+
+    parallel_test_case(test_case_nth_element_parallel, gen, seed);
+    for (const size_t testSize : large_test_sizes) {
+        test_case_nth_element_parallel(testSize, gen, seed);
+    }
+}
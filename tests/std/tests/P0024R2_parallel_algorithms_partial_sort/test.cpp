@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <execution>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// large enough that partial_sort selects the prefix with parallel partitions
+const size_t large_test_sizes[] = {16384, 100000, 1000003};
+
+void assert_message(const bool b, const char* const msg, const unsigned int seedValue) {
+    if (!b) {
+        cerr << msg << " failed for seed value: " << seedValue << "\n";
+        cerr << "This is a randomized test.\n";
+        cerr << "DO NOT IGNORE/RERUN THIS FAILURE.\n";
+        cerr << "You must report it to the STL maintainers.\n";
+        abort();
+    }
+}
+
+template <class Pr>
+void check_partial_sort(vector<int> c, const vector<int>& sorted, const size_t mid, Pr pred, const unsigned int seed) {
+    const auto midIt = c.begin() + static_cast<ptrdiff_t>(mid);
+    partial_sort(par, c.begin(), midIt, c.end(), pred);
+    assert_message(equal(c.begin(), midIt, sorted.begin()), "partial_sort prefix", seed);
+    sort(midIt, c.end(), pred);
+    assert_message(c == sorted, "partial_sort permutation", seed);
+}
+
+void test_case_partial_sort_parallel(const size_t testSize, mt19937& gen, const unsigned int seed) {
+    for (const int maxValue : {3, 1000000}) {
+        vector<int> c(testSize);
+        uniform_int_distribution<int> dis(0, maxValue);
+        generate(c.begin(), c.end(), [&] { return dis(gen); });
+        vector<int> sorted = c;
+        sort(sorted.begin(), sorted.end());
+
+        const size_t mids[] = {0, 1, testSize / 100, testSize / 2, testSize - 1, testSize};
+        for (const size_t mid : mids) {
+            if (mid <= testSize) {
+                check_partial_sort(c, sorted, mid, less<>{}, seed);
+            }
+        }
+
+        // the default comparison and greater
+        vector<int> d = c;
+        const auto midIt = d.begin() + static_cast<ptrdiff_t>(testSize / 3);
+        partial_sort(par, d.begin(), midIt, d.end());
+        assert_message(equal(d.begin(), midIt, sorted.begin()), "partial_sort default comparison", seed);
+
+        const vector<int> reversed(sorted.rbegin(), sorted.rend());
+        check_partial_sort(c, reversed, testSize / 3, greater<>{}, seed);
+    }
+}
+
+int main() {
+    random_device rd;
+    const unsigned int seed = rd();
+    mt19937 gen(seed);
+
+    parallel_test_case(test_case_partial_sort_parallel, gen, seed);
+    for (const size_t testSize : large_test_sizes) {
+        test_case_partial_sort_parallel(testSize, gen, seed);
+    }
+}
@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <forward_list>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto is_odd = [](unsigned int i) { return (i & 0x1u) != 0; };
+
+template <template <class...> class Container>
+void test_case_partition_copy_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> input(testSize);
+    vector<unsigned int> expectedTrue(testSize);
+    vector<unsigned int> expectedFalse(testSize);
+    vector<unsigned int> actualTrue(testSize);
+    vector<unsigned int> actualFalse(testSize);
+
+    // "fuzz" testing, including inputs that are all true and all false:
+    for (const unsigned int maxValue : {0U, 1U, 7U, 0xFFFFFFFFU}) {
+        uniform_int_distribution<unsigned int> dis(maxValue == 1 ? 1U : 0U, maxValue);
+        for (int i = 0; i < 25; ++i) {
+            generate(input.begin(), input.end(), [&] { return dis(gen); });
+            const auto expected =
+                partition_copy(input.begin(), input.end(), expectedTrue.begin(), expectedFalse.begin(), is_odd);
+            const auto actual =
+                partition_copy(par, input.begin(), input.end(), actualTrue.begin(), actualFalse.begin(), is_odd);
+            assert(equal(expectedTrue.begin(), expected.first, actualTrue.begin(), actual.first));
+            assert(equal(expectedFalse.begin(), expected.second, actualFalse.begin(), actual.second));
+        }
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_partition_copy_parallel<forward_list>, gen);
+    parallel_test_case(test_case_partition_copy_parallel<list>, gen);
+    parallel_test_case(test_case_partition_copy_parallel<vector>, gen);
+}
@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// tests the non-standard ranges:: algorithm overloads taking execution policies
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+struct record {
+    int key;
+    int seq;
+};
+
+// large enough that sort(par) distributes the elements among buckets, see std::_Distribution_sort_min_count
+const size_t distribution_sort_test_size = (1 << 16) + 5;
+
+vector<record> get_test_case_records(const size_t testSize, mt19937& gen) {
+    uniform_int_distribution<int> dist(0, 99);
+    vector<record> c(testSize);
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        c[idx] = {dist(gen), static_cast<int>(idx)};
+    }
+
+    return c;
+}
+
+void test_case_for_each_and_transform(const size_t testSize, mt19937& gen) {
+    auto c = get_test_case_records(testSize, gen);
+    assert(ranges::for_each(par, c, [](int& key) { key += 1000; }, &record::key) == c.end());
+    assert(ranges::all_of(c, [](int key) { return key >= 1000; }, &record::key));
+    assert(ranges::for_each(par, c.begin(), c.end(), [](record& r) { r.key -= 1000; }) == c.end());
+    assert(ranges::none_of(c, [](int key) { return key >= 1000; }, &record::key));
+
+    vector<int> out(testSize);
+    const auto unary = ranges::transform(par, c, out.begin(), [](int key) { return key * 2; }, &record::key);
+    assert(unary.in == c.end());
+    assert(unary.out == out.end());
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        assert(out[idx] == c[idx].key * 2);
+    }
+
+    const vector<int> shorter(testSize / 2, 1);
+    const auto binary = ranges::transform(par, c.begin(), c.end(), shorter.begin(), shorter.end(), out.begin(),
+        plus<>{}, &record::seq, negate<>{});
+    assert(binary.in1 == c.begin() + static_cast<ptrdiff_t>(shorter.size()));
+    assert(binary.in2 == shorter.end());
+    assert(binary.out == out.begin() + static_cast<ptrdiff_t>(shorter.size()));
+    for (size_t idx = 0; idx < shorter.size(); ++idx) {
+        assert(out[idx] == static_cast<int>(idx) - 1);
+    }
+
+    vector<int> copied(testSize);
+    const auto copy_result = ranges::copy(par, out, copied.begin());
+    assert(copy_result.in == out.end());
+    assert(copy_result.out == copied.end());
+    assert(copied == out);
+}
+
+void test_case_find_and_count(const size_t testSize, mt19937& gen) {
+    const auto c         = get_test_case_records(testSize, gen);
+    const auto is_big    = [](int key) { return key >= 90; };
+    const auto is_little = [](int key) { return key < 90; };
+    assert(ranges::find(par, c, 42, &record::key) == ranges::find(c, 42, &record::key));
+    assert(ranges::find_if(par, c.begin(), c.end(), is_big, &record::key) == ranges::find_if(c, is_big, &record::key));
+    assert(ranges::find_if_not(par, c, is_little, &record::key) == ranges::find_if(c, is_big, &record::key));
+    assert(ranges::count(par, c.begin(), c.end(), 42, &record::key) == ranges::count(c, 42, &record::key));
+    assert(ranges::count_if(par, c, is_big, &record::key) == ranges::count_if(c, is_big, &record::key));
+    assert(ranges::any_of(par, c, is_big, &record::key) == ranges::any_of(c, is_big, &record::key));
+    assert(
+        ranges::all_of(par, c.begin(), c.end(), is_little, &record::key) == ranges::all_of(c, is_little, &record::key));
+    assert(ranges::none_of(par, c, is_big, &record::key) == ranges::none_of(c, is_big, &record::key));
+
+    // C++20 iterators that aren't Cpp17 forward iterators are fine for the non-mutating algorithms
+    const auto n    = static_cast<int>(testSize);
+    const auto iota = views::iota(0, n);
+    assert(ranges::find(par, iota, n / 2) == ranges::next(iota.begin(), n / 2, iota.end()));
+    assert(ranges::count_if(par, iota.begin(), iota.end(), [](int x) { return x % 2 == 0; }) == (n + 1) / 2);
+}
+
+void test_case_sorts(const size_t testSize, mt19937& gen) {
+    auto c        = get_test_case_records(testSize, gen);
+    auto expected = c;
+    ranges::stable_sort(expected, ranges::greater{}, &record::key);
+    assert(ranges::stable_sort(par, c, ranges::greater{}, &record::key) == c.end());
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        assert(c[idx].key == expected[idx].key);
+        assert(c[idx].seq == expected[idx].seq);
+    }
+
+    assert(ranges::sort(par, c.begin(), c.end(), {}, &record::seq) == c.end());
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        assert(c[idx].seq == static_cast<int>(idx));
+    }
+
+    vector<unsigned int> keys(testSize);
+    generate(keys.begin(), keys.end(), ref(gen));
+    auto sorted_keys = keys;
+    ranges::sort(sorted_keys);
+    assert(ranges::sort(par, keys) == keys.end());
+    assert(keys == sorted_keys);
+}
+
+int main() {
+    mt19937 gen(1729);
+
+    parallel_test_case(test_case_for_each_and_transform, gen);
+    parallel_test_case(test_case_find_and_count, gen);
+    parallel_test_case(test_case_sorts, gen);
+
+    test_case_sorts(distribution_sort_test_size, gen);
+}
@@ -4,6 +4,7 @@
 #pragma warning(disable : 4242 4244 4365) // test_case_incorrect_special_case_reasoning tests narrowing on purpose
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <execution>
 #include <iterator>
 #include <memory>
@@ -39,6 +40,32 @@ void test_case_reduce(const size_t testSize, mt19937& gen) {
     assert(correct == reduce(par, b, e, 42U, add_a_different_way));
 }
 
+template <class T>
+void test_case_reduce_vectorized(const size_t testSize, mt19937& gen) {
+    // small integral values keep floating-point sums exact, so every association order gives the same result
+    vector<T> c(testSize);
+    const auto b = c.begin();
+    const auto e = c.end();
+    generate(b, e, [&] { return static_cast<T>(gen() % 100); });
+    const T correct = accumulate(b, e, T{42});
+    assert(correct == reduce(par, b, e, T{42}));
+    assert(correct == reduce(par_unseq, b, e, T{42}));
+    assert(correct == reduce(par_unseq, b, e, T{42}, plus<T>{}));
+#if _HAS_CXX20
+    assert(correct == reduce(unseq, b, e, T{42}));
+    assert(correct == reduce(unseq, b, e, T{42}, plus<T>{}));
+#endif // _HAS_CXX20
+}
+
+template <class T>
+void test_case_reduce_negative_zero(const size_t testSize) {
+    vector<T> c(testSize, T{-0.0});
+    assert(signbit(reduce(par_unseq, c.begin(), c.end(), T{-0.0})));
+#if _HAS_CXX20
+    assert(signbit(reduce(unseq, c.begin(), c.end(), T{-0.0})));
+#endif // _HAS_CXX20
+}
+
 vector<unique_ptr<vector<unsigned int>>> get_move_only_test_data(const size_t testSize) {
     vector<unique_ptr<vector<unsigned int>>> testData;
     testData.reserve(testSize);
@@ -77,6 +104,12 @@ void test_case_incorrect_special_case_reasoning() {
 int main() {
     mt19937 gen(1729);
     parallel_test_case(test_case_reduce, gen);
+    parallel_test_case(test_case_reduce_vectorized<int>, gen);
+    parallel_test_case(test_case_reduce_vectorized<long long>, gen);
+    parallel_test_case(test_case_reduce_vectorized<float>, gen);
+    parallel_test_case(test_case_reduce_vectorized<double>, gen);
+    parallel_test_case(test_case_reduce_negative_zero<float>);
+    parallel_test_case(test_case_reduce_negative_zero<double>);
     parallel_test_case([](const size_t testSize) { test_case_move_only(seq, testSize); });
     parallel_test_case([](const size_t testSize) { test_case_move_only(par, testSize); });
     test_case_incorrect_special_case_reasoning();
@@ -36,9 +36,41 @@ void test_case_replace_if_parallel(const size_t testSize, mt19937& gen) {
     assert(expected == actual);
 }
 
+void test_case_replace_copy_parallel(const size_t testSize, mt19937& gen) {
+    vector<char> source(testSize);
+    uniform_int_distribution<int> dist('a', 'z');
+    generate(source.begin(), source.end(), [&]() { return static_cast<char>(dist(gen)); });
+
+    vector<char> expected(testSize);
+    vector<char> actual(testSize);
+    replace_copy(source.begin(), source.end(), expected.begin(), 'a', 'b');
+    assert(replace_copy(par, source.begin(), source.end(), actual.begin(), 'a', 'b') == actual.end());
+    assert(expected == actual);
+}
+
+void test_case_replace_copy_if_parallel(const size_t testSize, mt19937& gen) {
+    vector<char> source(testSize);
+    uniform_int_distribution<int> dist('a', 'z');
+    generate(source.begin(), source.end(), [&]() { return static_cast<char>(dist(gen)); });
+
+    auto pred = [](char c) { return c == 'a'; };
+
+    vector<char> expected(testSize);
+    vector<char> actual(testSize);
+    replace_copy_if(source.begin(), source.end(), expected.begin(), pred, 'b');
+    assert(replace_copy_if(par, source.begin(), source.end(), actual.begin(), pred, 'b') == actual.end());
+    assert(expected == actual);
+}
+
 int main() {
     mt19937 gen(1729);
 
     parallel_test_case(test_case_replace_parallel, gen);
     parallel_test_case(test_case_replace_if_parallel, gen);
+    parallel_test_case(test_case_replace_copy_parallel, gen);
+    parallel_test_case(test_case_replace_copy_if_parallel, gen);
+
+    // large enough that replace_copy is split into several chunks, see std::_Bandwidth_bound_chunk_min_bytes
+    test_case_replace_copy_parallel(1 << 20, gen);
+    test_case_replace_copy_if_parallel(1 << 20, gen);
 }
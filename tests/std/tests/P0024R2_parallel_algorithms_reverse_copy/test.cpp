@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// large enough that the copies below are split into several chunks, see std::_Bandwidth_bound_chunk_min_bytes
+const size_t bandwidth_bound_test_size = 1 << 18;
+
+template <template <class...> class Container>
+void test_case_reverse_copy_parallel(const size_t testSize) {
+    Container<int> c(testSize);
+    iota(c.begin(), c.end(), 0);
+    vector<int> expected(testSize + 1, -1);
+    vector<int> actual(testSize + 1, -1);
+    const auto expectedEnd = reverse_copy(c.begin(), c.end(), expected.begin());
+    const auto actualEnd   = reverse_copy(par, c.begin(), c.end(), actual.begin());
+    assert(actualEnd - actual.begin() == expectedEnd - expected.begin());
+    assert(expected == actual);
+}
+
+template <template <class...> class Container>
+void test_case_rotate_copy_parallel(const size_t testSize) {
+    Container<int> c(testSize);
+    iota(c.begin(), c.end(), 0);
+    vector<int> expected(testSize + 1, -1);
+    vector<int> actual(testSize + 1, -1);
+    for (size_t midOffset : {size_t{0}, testSize / 3, testSize}) {
+        const auto mid         = next(c.begin(), static_cast<ptrdiff_t>(midOffset));
+        const auto expectedEnd = rotate_copy(c.begin(), mid, c.end(), expected.begin());
+        const auto actualEnd   = rotate_copy(par, c.begin(), mid, c.end(), actual.begin());
+        assert(actualEnd - actual.begin() == expectedEnd - expected.begin());
+        assert(expected == actual);
+    }
+}
+
+void test_case_swap_ranges_parallel(const size_t testSize) {
+    vector<string> a(testSize, "a");
+    vector<string> b(testSize + 1, "b");
+    assert(swap_ranges(par, a.begin(), a.end(), b.begin()) == b.end() - 1);
+    assert(all_of(a.begin(), a.end(), [](const string& s) { return s == "b"; }));
+    assert(all_of(b.begin(), b.end() - 1, [](const string& s) { return s == "a"; }));
+    assert(b.back() == "b");
+}
+
+void test_case_generate_parallel(const size_t testSize) {
+    vector<int> v(testSize);
+    generate(par, v.begin(), v.end(), [] { return 42; });
+    assert(all_of(v.begin(), v.end(), [](int x) { return x == 42; }));
+    const auto mid = v.begin() + static_cast<ptrdiff_t>(testSize / 2);
+    assert(generate_n(par, v.begin(), mid - v.begin(), [] { return 1729; }) == mid);
+    assert(all_of(v.begin(), mid, [](int x) { return x == 1729; }));
+    assert(all_of(mid, v.end(), [](int x) { return x == 42; }));
+}
+
+#if _HAS_CXX20
+void test_case_shift_parallel(const size_t testSize) {
+    const auto size = static_cast<ptrdiff_t>(testSize);
+    vector<int> expected(testSize);
+    vector<int> actual(testSize);
+    const ptrdiff_t shifts[] = {0, 1, size / 3, size / 2 + 1, size == 0 ? 0 : size - 1, size, size + 1};
+    for (const ptrdiff_t shift : shifts) {
+        iota(expected.begin(), expected.end(), 0);
+        iota(actual.begin(), actual.end(), 0);
+        const auto expectedLeft = shift_left(expected.begin(), expected.end(), shift);
+        const auto actualLeft   = shift_left(par, actual.begin(), actual.end(), shift);
+        assert(actualLeft - actual.begin() == expectedLeft - expected.begin());
+        assert(equal(actual.begin(), actualLeft, expected.begin()));
+
+        iota(expected.begin(), expected.end(), 0);
+        iota(actual.begin(), actual.end(), 0);
+        const auto expectedRight = shift_right(expected.begin(), expected.end(), shift);
+        const auto actualRight   = shift_right(par, actual.begin(), actual.end(), shift);
+        assert(actualRight - actual.begin() == expectedRight - expected.begin());
+        assert(equal(actualRight, actual.end(), expectedRight));
+    }
+}
+#endif // _HAS_CXX20
+
+int main() {
+    parallel_test_case(test_case_reverse_copy_parallel<list>);
+    parallel_test_case(test_case_reverse_copy_parallel<vector>);
+    parallel_test_case(test_case_rotate_copy_parallel<list>);
+    parallel_test_case(test_case_rotate_copy_parallel<vector>);
+    parallel_test_case(test_case_swap_ranges_parallel);
+    parallel_test_case(test_case_generate_parallel);
+#if _HAS_CXX20
+    parallel_test_case(test_case_shift_parallel);
+#endif // _HAS_CXX20
+
+    test_case_reverse_copy_parallel<vector>(bandwidth_bound_test_size);
+    test_case_rotate_copy_parallel<vector>(bandwidth_bound_test_size);
+    test_case_swap_ranges_parallel(bandwidth_bound_test_size);
+#if _HAS_CXX20
+    test_case_shift_parallel(bandwidth_bound_test_size);
+#endif // _HAS_CXX20
+}
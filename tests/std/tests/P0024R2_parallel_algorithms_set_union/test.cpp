@@ -0,0 +1,108 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <execution>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// elements remember which input they came from, so that the choice between equivalent elements is observable
+using tagged = pair<int, int>;
+
+struct less_key {
+    bool operator()(const tagged& lhs, const tagged& rhs) const {
+        return lhs.first < rhs.first;
+    }
+};
+
+template <class T>
+void assert_message_vector(const bool b, const char* const msg, const T seedValue) {
+    if (!b) {
+        cerr << msg << " failed for seed value: " << seedValue << "\n";
+        cerr << "This is a randomized test.\n";
+        cerr << "DO NOT IGNORE/RERUN THIS FAILURE.\n";
+        cerr << "You must report it to the STL maintainers.\n";
+        abort();
+    }
+}
+
+vector<tagged> make_sorted_tagged(mt19937& gen, const size_t count, const int maxKey, const int tag) {
+    uniform_int_distribution<int> dis(0, maxKey);
+    vector<tagged> result(count);
+    for (auto& elem : result) {
+        elem = {dis(gen), tag};
+    }
+
+    sort(result.begin(), result.end());
+    return result;
+}
+
+void test_case_set_union_parallel(const size_t testSize) {
+    {
+        // === Evens and odds, then identical ranges ===
+        vector<int> evens;
+        vector<int> odds;
+        for (size_t i = 0; i < testSize; ++i) {
+            (i % 2 == 0 ? evens : odds).push_back(static_cast<int>(i));
+        }
+
+        vector<int> expected(testSize);
+        iota(expected.begin(), expected.end(), 0);
+        vector<int> actual(testSize);
+        assert(set_union(par, evens.begin(), evens.end(), odds.begin(), odds.end(), actual.begin()) == actual.end());
+        assert(actual == expected);
+
+        assert(set_union(par, expected.begin(), expected.end(), expected.begin(), expected.end(), actual.begin())
+               == actual.end());
+        assert(actual == expected);
+
+        reverse(evens.begin(), evens.end());
+        reverse(odds.begin(), odds.end());
+        reverse(expected.begin(), expected.end());
+        assert(set_union(par, odds.begin(), odds.end(), evens.begin(), evens.end(), actual.begin(), greater<>{})
+               == actual.end());
+        assert(actual == expected);
+    }
+
+    const auto seedValue = random_device{}();
+    mt19937 gen(seedValue);
+
+    // === Randomized ranges with many and with few equivalent elements, and with uneven lengths ===
+    for (const int maxKey : {2, static_cast<int>(testSize / 4), static_cast<int>(testSize * 2)}) {
+        for (const size_t otherSize : {testSize, testSize / 3}) {
+            const auto list1 = make_sorted_tagged(gen, testSize, maxKey, 1);
+            const auto list2 = make_sorted_tagged(gen, otherSize, maxKey, 2);
+            vector<tagged> seqRes(list1.size() + list2.size());
+            vector<tagged> parRes(seqRes.size());
+
+            auto seqComp =
+                set_union(list1.begin(), list1.end(), list2.begin(), list2.end(), seqRes.begin(), less_key{});
+            auto parComp =
+                set_union(par, list1.begin(), list1.end(), list2.begin(), list2.end(), parRes.begin(), less_key{});
+            assert_message_vector(equal(seqRes.begin(), seqComp, parRes.begin(), parComp),
+                "Randomized vectors, set union 1", seedValue);
+
+            seqComp = set_union(list2.begin(), list2.end(), list1.begin(), list1.end(), seqRes.begin(), less_key{});
+            parComp =
+                set_union(par, list2.begin(), list2.end(), list1.begin(), list1.end(), parRes.begin(), less_key{});
+            assert_message_vector(equal(seqRes.begin(), seqComp, parRes.begin(), parComp),
+                "Randomized vectors, set union 2", seedValue);
+        }
+    }
+}
+
+int main() {
+    parallel_test_case(test_case_set_union_parallel);
+}
@@ -3,9 +3,12 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <execution>
+#include <functional>
 #include <numeric>
 #include <random>
+#include <string>
 #include <vector>
 
 #include <parallel_algorithms_utilities.hpp>
@@ -35,9 +38,80 @@ void test_case_sort_parallel(const size_t testSize, mt19937& gen) {
     assert(is_sorted(c.begin(), c.end()));
 }
 
+// large enough that sort distributes the elements among buckets, see std::_Distribution_sort_min_count
+const size_t distribution_sort_test_size = (1 << 17) + 7;
+
+template <class T, class Pr = less<>>
+void assert_sorts_like_serial(vector<T> c, Pr pred = {}) {
+    vector<T> expected = c;
+    sort(expected.begin(), expected.end(), pred);
+    sort(par, c.begin(), c.end(), pred);
+    assert(c == expected);
+}
+
+void test_case_sort_distribution(mt19937& gen) {
+    // arithmetic keys ordered by less are radix sorted
+    vector<int> ints(distribution_sort_test_size);
+    generate(ints.begin(), ints.end(), [&] { return static_cast<int>(gen()); });
+    assert_sorts_like_serial(ints);
+    assert_sorts_like_serial(ints, less<int>{});
+    // ... and everything else is sample sorted
+    assert_sorts_like_serial(ints, greater<>{});
+
+    // equivalent elements may end up in any order
+    const auto coarse_less = [](int lhs, int rhs) { return lhs / 1024 < rhs / 1024; };
+    vector<int> coarse     = ints;
+    sort(par, coarse.begin(), coarse.end(), coarse_less);
+    assert(is_sorted(coarse.begin(), coarse.end(), coarse_less));
+    sort(coarse.begin(), coarse.end());
+    sort(ints.begin(), ints.end());
+    assert(coarse == ints);
+
+    iota(ints.begin(), ints.end(), -1000);
+    assert_sorts_like_serial(ints);
+    assert_sorts_like_serial(ints, greater<>{});
+    reverse(ints.begin(), ints.end());
+    assert_sorts_like_serial(ints);
+    assert_sorts_like_serial(ints, greater<>{});
+
+    // many duplicates, some of them chosen as splitters
+    uniform_int_distribution<int> few(0, 5);
+    generate(ints.begin(), ints.end(), [&] { return few(gen); });
+    assert_sorts_like_serial(ints);
+    assert_sorts_like_serial(ints, greater<>{});
+    fill(ints.begin(), ints.end(), 42);
+    assert_sorts_like_serial(ints, greater<>{});
+
+    vector<unsigned char> bytes(distribution_sort_test_size);
+    generate(bytes.begin(), bytes.end(), [&] { return static_cast<unsigned char>(gen()); });
+    assert_sorts_like_serial(bytes);
+
+    vector<long long> longs(distribution_sort_test_size);
+    generate(longs.begin(), longs.end(), [&] { return static_cast<long long>(gen()) - (1LL << 31); });
+    assert_sorts_like_serial(longs);
+
+    // negative values, and values differing only in their low bytes; no zeroes, as -0.0 and 0.0 are equivalent
+    uniform_real_distribution<double> real(-1e6, 1e6);
+    vector<double> doubles(distribution_sort_test_size);
+    generate(doubles.begin(), doubles.end(), [&] { return real(gen); });
+    doubles[0] = 1e-310;
+    doubles[1] = -1e-310;
+    doubles[2] = -1e300;
+    assert_sorts_like_serial(doubles);
+    vector<float> floats(distribution_sort_test_size);
+    generate(floats.begin(), floats.end(), [&] { return static_cast<float>(real(gen)); });
+    assert_sorts_like_serial(floats, less<float>{});
+
+    vector<string> strings(distribution_sort_test_size);
+    generate(strings.begin(), strings.end(), [&] { return to_string(gen() % 50000); });
+    assert_sorts_like_serial(strings);
+    assert_sorts_like_serial(strings, greater<>{});
+}
+
 int main() {
     mt19937 gen(1729);
 
     test_case_sort_parallel_special_cases();
     parallel_test_case(test_case_sort_parallel, gen);
+    test_case_sort_distribution(gen);
 }
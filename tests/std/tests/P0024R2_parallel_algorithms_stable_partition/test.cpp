@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto is_even = [](unsigned int i) { return (i & 0x1u) == 0; };
+
+// takes its argument by value, so it would observe elements that were moved from
+const auto starts_with_odd_digit = [](string s) { return (s[0] & 0x1) != 0; };
+
+template <template <class...> class Container>
+void test_case_stable_partition_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> tmp(testSize);
+    iota(tmp.begin(), tmp.end(), 0U);
+    {
+        const auto tmpStart = tmp;
+        assert(stable_partition(par, tmp.begin(), tmp.end(), [](auto) { return true; }) == tmp.end());
+        assert(tmp == tmpStart);
+        assert(stable_partition(par, tmp.begin(), tmp.end(), [](auto) { return false; }) == tmp.begin());
+        assert(tmp == tmpStart);
+
+        const auto result = stable_partition(par, tmp.begin(), tmp.end(), is_even);
+        assert(distance(tmp.begin(), result) == static_cast<ptrdiff_t>(testSize - (testSize >> 1)));
+        assert(all_of(tmp.begin(), result, is_even));
+        assert(none_of(result, tmp.end(), is_even));
+        assert(is_sorted(tmp.begin(), result));
+        assert(is_sorted(result, tmp.end()));
+    }
+
+    // "fuzz" testing:
+    Container<string> expected(testSize);
+    Container<string> actual(testSize);
+    uniform_int_distribution<int> dis(0, 99);
+    for (int i = 0; i < 50; ++i) {
+        generate(expected.begin(), expected.end(), [&] { return to_string(dis(gen)); });
+        actual                 = expected;
+        const auto expectedMid = stable_partition(expected.begin(), expected.end(), starts_with_odd_digit);
+        const auto actualMid   = stable_partition(par, actual.begin(), actual.end(), starts_with_odd_digit);
+        assert(distance(expected.begin(), expectedMid) == distance(actual.begin(), actualMid));
+        assert(expected == actual);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_stable_partition_parallel<list>, gen);
+    parallel_test_case(test_case_stable_partition_parallel<vector>, gen);
+}
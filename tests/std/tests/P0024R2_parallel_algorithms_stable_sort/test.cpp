@@ -6,6 +6,7 @@
 #include <execution>
 #include <list>
 #include <random>
+#include <string>
 #include <vector>
 
 #include <parallel_algorithms_utilities.hpp>
@@ -82,6 +83,21 @@ void test_case_stable_sort_parallel_vector(const size_t testSize, mt19937& gen)
     assert_stable_sort_cmpTens_test_case(c.begin(), c.end());
 }
 
+// large enough that the top levels of the merge tree are split among the threads,
+// see std::_Merge_stable_sort_top_levels
+const size_t merge_path_test_size = (1 << 17) + 3;
+
+void test_case_stable_sort_parallel_strings(const size_t testSize, mt19937& gen) {
+    uniform_int_distribution<size_t> dist(0, 1000000);
+    vector<string> c(testSize);
+    generate(c.begin(), c.end(), [&] { return to_string(dist(gen)); });
+    const auto shorter = [](const string& lhs, const string& rhs) { return lhs.size() < rhs.size(); };
+    auto expected      = c;
+    stable_sort(expected.begin(), expected.end(), shorter);
+    stable_sort(par, c.begin(), c.end(), shorter);
+    assert(c == expected);
+}
+
 int main() {
     mt19937 gen(1729);
 
@@ -89,4 +105,8 @@ int main() {
     test_case_stable_sort_parallel_special_cases<vector>();
     parallel_test_case(test_case_stable_sort_parallel_list, gen);
     parallel_test_case(test_case_stable_sort_parallel_vector, gen);
+    parallel_test_case(test_case_stable_sort_parallel_strings, gen);
+
+    test_case_stable_sort_parallel_vector(merge_path_test_size, gen);
+    test_case_stable_sort_parallel_strings(merge_path_test_size, gen);
 }
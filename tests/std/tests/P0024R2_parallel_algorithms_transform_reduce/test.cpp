@@ -50,6 +50,25 @@ void test_case_transform_reduce_binary(const size_t testSize, mt19937& gen) {
                par, inputBegin, inputEnd, resultsBegin, 42U, add_a_different_way, multiply_a_different_way));
 }
 
+template <class T>
+void test_case_transform_reduce_binary_vectorized(const size_t testSize, mt19937& gen) {
+    // small integral values keep floating-point sums exact, so every association order gives the same result
+    vector<T> c(testSize * 2);
+    const auto inputBegin   = c.begin();
+    const auto inputEnd     = c.begin() + static_cast<ptrdiff_t>(testSize);
+    const auto resultsBegin = inputEnd;
+    generate(c.begin(), c.end(), [&] { return static_cast<T>(gen() % 16); });
+    const T correct = inner_product(inputBegin, inputEnd, resultsBegin, T{42});
+    assert(correct == transform_reduce(par, inputBegin, inputEnd, resultsBegin, T{42}));
+    assert(correct == transform_reduce(par_unseq, inputBegin, inputEnd, resultsBegin, T{42}));
+    assert(correct
+           == transform_reduce(par_unseq, inputBegin, inputEnd, resultsBegin, T{42}, plus<T>{}, multiplies<T>{}));
+#if _HAS_CXX20
+    assert(correct == transform_reduce(unseq, inputBegin, inputEnd, resultsBegin, T{42}));
+    assert(correct == transform_reduce(unseq, inputBegin, inputEnd, resultsBegin, T{42}, plus<T>{}, multiplies<T>{}));
+#endif // _HAS_CXX20
+}
+
 const auto times_ten = [](unsigned int a) { return a * 10; };
 
 void test_case_transform_reduce(const size_t testSize, mt19937& gen) {
@@ -168,6 +187,8 @@ void test_case_narrowing_conversion() {
 int main() {
     mt19937 gen(1729);
     parallel_test_case(test_case_transform_reduce_binary, gen);
+    parallel_test_case(test_case_transform_reduce_binary_vectorized<float>, gen);
+    parallel_test_case(test_case_transform_reduce_binary_vectorized<double>, gen);
     parallel_test_case(test_case_transform_reduce, gen);
     parallel_test_case([](const size_t testSize) { test_case_move_only_binary(seq, testSize); });
     parallel_test_case([](const size_t testSize) { test_case_move_only_binary(par, testSize); });
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <forward_list>
+#include <list>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// an equivalence relation that is coarser than equality, so it matters which element of each group is kept
+const auto same_first_char = [](const string& lhs, const string& rhs) { return lhs[0] == rhs[0]; };
+
+template <template <class...> class Container>
+void test_case_unique_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> tmp(testSize);
+    iota(tmp.begin(), tmp.end(), 0U);
+    {
+        // remove nothing:
+        const auto tmpStart = tmp;
+        assert(unique(par, tmp.begin(), tmp.end()) == tmp.end());
+        assert(tmp == tmpStart);
+
+        // remove everything but the first element:
+        fill(tmp.begin(), tmp.end(), 42U);
+        const auto result = unique(par, tmp.begin(), tmp.end());
+        assert(distance(tmp.begin(), result) == (testSize == 0 ? 0 : 1));
+    }
+
+    // "fuzz" testing, from inputs that are all one group to inputs with few repeats:
+    Container<string> input(testSize);
+    for (const int maxValue : {0, 1, 9}) {
+        uniform_int_distribution<int> dis(0, maxValue);
+        for (int i = 0; i < 25; ++i) {
+            generate(input.begin(), input.end(), [&] { return to_string(dis(gen)) + to_string(dis(gen)); });
+
+            auto expected    = input;
+            auto actual      = input;
+            auto expectedEnd = unique(expected.begin(), expected.end());
+            auto actualEnd   = unique(par, actual.begin(), actual.end());
+            assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+            expected    = input;
+            actual      = input;
+            expectedEnd = unique(expected.begin(), expected.end(), same_first_char);
+            actualEnd   = unique(par, actual.begin(), actual.end(), same_first_char);
+            assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+        }
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_unique_parallel<forward_list>, gen);
+    parallel_test_case(test_case_unique_parallel<list>, gen);
+    parallel_test_case(test_case_unique_parallel<vector>, gen);
+}
@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// an equivalence relation that is coarser than equality, so it matters which element of each group is kept
+const auto same_quarter = [](unsigned int lhs, unsigned int rhs) { return lhs / 4 == rhs / 4; };
+
+template <template <class...> class Container>
+void test_case_unique_copy_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> input(testSize);
+    vector<unsigned int> expected(testSize);
+    vector<unsigned int> actual(testSize);
+
+    // "fuzz" testing, from inputs that are all one group to inputs with few repeats:
+    for (const unsigned int maxValue : {0U, 3U, 15U, 1000U}) {
+        uniform_int_distribution<unsigned int> dis(0, maxValue);
+        for (int i = 0; i < 25; ++i) {
+            generate(input.begin(), input.end(), [&] { return dis(gen); });
+
+            auto expectedEnd = unique_copy(input.begin(), input.end(), expected.begin());
+            auto actualEnd   = unique_copy(par, input.begin(), input.end(), actual.begin());
+            assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+
+            expectedEnd = unique_copy(input.begin(), input.end(), expected.begin(), same_quarter);
+            actualEnd   = unique_copy(par, input.begin(), input.end(), actual.begin(), same_quarter);
+            assert(equal(expected.begin(), expectedEnd, actual.begin(), actualEnd));
+        }
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_unique_copy_parallel<forward_list>, gen);
+    parallel_test_case(test_case_unique_copy_parallel<list>, gen);
+    parallel_test_case(test_case_unique_copy_parallel<vector>, gen);
+}
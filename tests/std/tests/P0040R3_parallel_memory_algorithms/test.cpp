@@ -4,8 +4,10 @@
 #include <algorithm>
 #include <cassert>
 #include <execution>
+#include <list>
 #include <memory>
 #include <numeric>
+#include <string>
 #include <vector>
 
 #include <parallel_algorithms_utilities.hpp>
@@ -398,6 +400,90 @@ struct test_case_uninitialized_fill_n_parallel {
     }
 };
 
+struct test_case_uninitialized_copy_nontrivial_parallel {
+    template <class ExecutionPolicy>
+    void operator()(const size_t testSize, const ExecutionPolicy& exec) {
+        vector<string> source(testSize);
+        for (size_t i = 0; i != testSize; ++i) {
+            source[i] = "long enough to defeat the small string optimization " + to_string(i);
+        }
+
+        auto buffer         = make_unconstructed_nondestroying_buffer<string>(testSize);
+        const auto begin_it = buffer.get();
+        const auto end_it   = begin_it + testSize;
+
+        const auto result_it = uninitialized_copy(exec, source.begin(), source.end(), begin_it);
+        assert(end_it == result_it);
+        assert(equal(source.begin(), source.end(), begin_it, end_it));
+        destroy(begin_it, end_it);
+
+        const auto result_it_n = uninitialized_copy_n(exec, source.begin(), testSize, begin_it);
+        assert(end_it == result_it_n);
+        assert(equal(source.begin(), source.end(), begin_it, end_it));
+        destroy(begin_it, end_it);
+    }
+};
+
+struct test_case_uninitialized_move_nontrivial_parallel {
+    template <class ExecutionPolicy>
+    void operator()(const size_t testSize, const ExecutionPolicy& exec) {
+        vector<string> expected(testSize);
+        for (size_t i = 0; i != testSize; ++i) {
+            expected[i] = "long enough to defeat the small string optimization " + to_string(i);
+        }
+
+        auto buffer         = make_unconstructed_nondestroying_buffer<string>(testSize);
+        const auto begin_it = buffer.get();
+        const auto end_it   = begin_it + testSize;
+
+        auto source          = expected;
+        const auto result_it = uninitialized_move(exec, source.begin(), source.end(), begin_it);
+        assert(end_it == result_it);
+        assert(equal(expected.begin(), expected.end(), begin_it, end_it));
+        destroy(begin_it, end_it);
+
+        source                 = expected;
+        const auto result_pair = uninitialized_move_n(exec, source.begin(), testSize, begin_it);
+        assert(source.end() == result_pair.first && end_it == result_pair.second);
+        assert(equal(expected.begin(), expected.end(), begin_it, end_it));
+        destroy(begin_it, end_it);
+    }
+};
+
+struct test_case_uninitialized_fill_nontrivial_parallel {
+    template <class ExecutionPolicy>
+    void operator()(const size_t testSize, const ExecutionPolicy& exec) {
+        const string value{"long enough to defeat the small string optimization"};
+        const auto is_value = [&](const string& s) { return s == value; };
+
+        auto buffer         = make_unconstructed_nondestroying_buffer<string>(testSize);
+        const auto begin_it = buffer.get();
+        const auto end_it   = begin_it + testSize;
+
+        uninitialized_fill(exec, begin_it, end_it, value);
+        assert(all_of(begin_it, end_it, is_value));
+        destroy(begin_it, end_it);
+
+        const auto result_it = uninitialized_fill_n(exec, begin_it, testSize, value);
+        assert(end_it == result_it);
+        assert(all_of(begin_it, end_it, is_value));
+        destroy(begin_it, end_it);
+    }
+};
+
+struct test_case_uninitialized_copy_forward_parallel {
+    template <class ExecutionPolicy>
+    void operator()(const size_t testSize, const ExecutionPolicy& exec) {
+        list<int> source(testSize);
+        iota(source.begin(), source.end(), 42);
+        list<int> dest(testSize, bad_int);
+
+        const auto result_it = uninitialized_copy(exec, source.begin(), source.end(), dest.begin());
+        assert(dest.end() == result_it);
+        assert(source == dest);
+    }
+};
+
 int main() {
     parallel_test_case(test_case_uninitialized_default_construct_parallel{}, par);
     parallel_test_case(test_case_uninitialized_default_construct_n_parallel{}, par);
@@ -413,14 +499,16 @@ int main() {
     parallel_test_case(test_case_destroy_n_parallel{}, par);
     parallel_test_case(test_case_destroy_nontrivial_parallel{}, par);
     parallel_test_case(test_case_destroy_n_nontrivial_parallel{}, par);
-
-    // currently not parallelized
     parallel_test_case(test_case_uninitialized_copy_parallel{}, par);
     parallel_test_case(test_case_uninitialized_copy_n_parallel{}, par);
     parallel_test_case(test_case_uninitialized_move_parallel{}, par);
     parallel_test_case(test_case_uninitialized_move_n_parallel{}, par);
     parallel_test_case(test_case_uninitialized_fill_parallel{}, par);
     parallel_test_case(test_case_uninitialized_fill_n_parallel{}, par);
+    parallel_test_case(test_case_uninitialized_copy_nontrivial_parallel{}, par);
+    parallel_test_case(test_case_uninitialized_move_nontrivial_parallel{}, par);
+    parallel_test_case(test_case_uninitialized_fill_nontrivial_parallel{}, par);
+    parallel_test_case(test_case_uninitialized_copy_forward_parallel{}, par);
 #if _HAS_CXX20
     parallel_test_case(test_case_uninitialized_default_construct_parallel{}, unseq);
     parallel_test_case(test_case_uninitialized_default_construct_n_parallel{}, unseq);
@@ -436,13 +524,15 @@ int main() {
     parallel_test_case(test_case_destroy_n_parallel{}, unseq);
     parallel_test_case(test_case_destroy_nontrivial_parallel{}, unseq);
     parallel_test_case(test_case_destroy_n_nontrivial_parallel{}, unseq);
-
-    // currently not parallelized
     parallel_test_case(test_case_uninitialized_copy_parallel{}, unseq);
     parallel_test_case(test_case_uninitialized_copy_n_parallel{}, unseq);
     parallel_test_case(test_case_uninitialized_move_parallel{}, unseq);
     parallel_test_case(test_case_uninitialized_move_n_parallel{}, unseq);
     parallel_test_case(test_case_uninitialized_fill_parallel{}, unseq);
     parallel_test_case(test_case_uninitialized_fill_n_parallel{}, unseq);
+    parallel_test_case(test_case_uninitialized_copy_nontrivial_parallel{}, unseq);
+    parallel_test_case(test_case_uninitialized_move_nontrivial_parallel{}, unseq);
+    parallel_test_case(test_case_uninitialized_fill_nontrivial_parallel{}, unseq);
+    parallel_test_case(test_case_uninitialized_copy_forward_parallel{}, unseq);
 #endif // _HAS_CXX20
 }
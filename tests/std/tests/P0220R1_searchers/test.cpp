@@ -437,6 +437,65 @@ void test_case_randomized_cases() {
     }
 }
 
+// Byte patterns up to some length are searched with the vector algorithm; longer ones use the delta tables.
+// Check both sides of that threshold against a search which can't be vectorized, reusing each searcher.
+void test_case_vectorized_byte_patterns() {
+    mt19937 mt;
+    initialize_randomness(mt);
+
+    constexpr size_t MaxNeedleLength = 70;
+    constexpr size_t HaystackLength  = 300;
+
+    const auto slow_equal = [](const char lhs, const char rhs) { return lhs == rhs; };
+
+    for (int max_char = 'b'; max_char <= 'd'; ++max_char) {
+        uniform_int_distribution<int> characters('a', max_char);
+        uniform_int_distribution<size_t> positions(0, HaystackLength);
+
+        for (size_t needle_length = 1; needle_length <= MaxNeedleLength; ++needle_length) {
+            string needle(needle_length, '?');
+            for (auto& ch : needle) {
+                ch = static_cast<char>(characters(mt));
+            }
+
+            const boyer_moore_searcher bms{needle.begin(), needle.end()};
+            const boyer_moore_horspool_searcher bmhs{needle.begin(), needle.end()};
+
+            for (int h = 0; h < 20; ++h) {
+                string haystack(HaystackLength, '?');
+                for (auto& ch : haystack) {
+                    ch = static_cast<char>(characters(mt));
+                }
+
+                // Plant the needle, so that long needles have a match
+                if (const size_t pos = positions(mt); pos + needle_length <= HaystackLength) {
+                    haystack.replace(pos, needle_length, needle);
+                }
+
+                for (size_t first = 0; first < 40; first += 13) {
+                    const auto haystack_first = haystack.cbegin() + static_cast<ptrdiff_t>(first);
+                    const auto haystack_last  = haystack.cend();
+
+                    const auto correct_first =
+                        search(haystack_first, haystack_last, needle.begin(), needle.end(), slow_equal);
+                    const auto correct_last = correct_first == haystack_last
+                                                ? haystack_last
+                                                : correct_first + static_cast<ptrdiff_t>(needle_length);
+                    const pair correct{correct_first, correct_last};
+
+                    if (bms(haystack_first, haystack_last) != correct) {
+                        report_randomized_failure("boyer_moore_searcher", needle, haystack);
+                    }
+
+                    if (bmhs(haystack_first, haystack_last) != correct) {
+                        report_randomized_failure("boyer_moore_horspool_searcher", needle, haystack);
+                    }
+                }
+            }
+        }
+    }
+}
+
 #ifndef _M_CEE // TRANSITION, VSO-1659496
 template <class Tag, class T>
 struct tagged_hash {
@@ -528,4 +587,5 @@ int main() {
     test_case_BM_unicode32<boyer_moore_horspool_searcher>();
 
     test_case_randomized_cases();
+    test_case_vectorized_byte_patterns();
 }
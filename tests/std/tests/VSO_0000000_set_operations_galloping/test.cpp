@@ -0,0 +1,247 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// includes(), set_intersection(), and set_difference() switch to exponential search when one input is consumed much
+// faster than the other. Check that the results (including the order of equivalent elements) match the lockstep loop,
+// that skewed inputs take sublinear numbers of comparisons, and that long runs stay within the standard's limits.
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <list>
+#include <random>
+#include <vector>
+
+#if _HAS_CXX20
+#include <ranges>
+#endif // _HAS_CXX20
+
+using namespace std;
+
+struct elem {
+    int key;
+    int id;
+};
+
+struct counting_less {
+    size_t* count;
+
+    bool operator()(const elem& lhs, const elem& rhs) const {
+        ++*count;
+        return lhs.key < rhs.key;
+    }
+};
+
+bool same_elements(const vector<elem>& lhs, const vector<elem>& rhs) {
+    return equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+        [](const elem& l, const elem& r) { return l.key == r.key && l.id == r.id; });
+}
+
+// The list iterators below take the lockstep loop, which serves as the reference.
+void test_case(const vector<elem>& left, const vector<elem>& right) {
+    const list<elem> left_list(left.begin(), left.end());
+    const list<elem> right_list(right.begin(), right.end());
+
+    size_t count = 0;
+    const counting_less pred{&count};
+
+    vector<elem> expected(left.size() + right.size());
+    vector<elem> actual(left.size() + right.size());
+
+    const auto check = [&](const auto expected_last, const auto actual_last) {
+        expected.resize(static_cast<size_t>(expected_last - expected.begin()));
+        actual.resize(static_cast<size_t>(actual_last - actual.begin()));
+        assert(same_elements(expected, actual));
+        expected.resize(left.size() + right.size());
+        actual.resize(left.size() + right.size());
+    };
+
+    check(merge(left_list.begin(), left_list.end(), right_list.begin(), right_list.end(), expected.begin(), pred),
+        merge(left.begin(), left.end(), right.begin(), right.end(), actual.begin(), pred));
+    check(set_intersection(
+              left_list.begin(), left_list.end(), right_list.begin(), right_list.end(), expected.begin(), pred),
+        set_intersection(left.begin(), left.end(), right.begin(), right.end(), actual.begin(), pred));
+    check(set_difference(
+              left_list.begin(), left_list.end(), right_list.begin(), right_list.end(), expected.begin(), pred),
+        set_difference(left.begin(), left.end(), right.begin(), right.end(), actual.begin(), pred));
+    assert(includes(left_list.begin(), left_list.end(), right_list.begin(), right_list.end(), pred)
+           == includes(left.begin(), left.end(), right.begin(), right.end(), pred));
+
+#if _HAS_CXX20
+    const auto merge_r = ranges::merge(left, right, actual.begin(), ranges::less{}, &elem::key, &elem::key);
+    assert(merge_r.in1 == left.end());
+    assert(merge_r.in2 == right.end());
+    check(ranges::merge(left_list, right_list, expected.begin(), ranges::less{}, &elem::key, &elem::key).out,
+        merge_r.out);
+
+    const auto intersection_r =
+        ranges::set_intersection(left, right, actual.begin(), ranges::less{}, &elem::key, &elem::key);
+    assert(intersection_r.in1 == left.end());
+    assert(intersection_r.in2 == right.end());
+    check(ranges::set_intersection(left_list, right_list, expected.begin(), ranges::less{}, &elem::key, &elem::key)
+              .out,
+        intersection_r.out);
+
+    const auto difference_r =
+        ranges::set_difference(left, right, actual.begin(), ranges::less{}, &elem::key, &elem::key);
+    assert(difference_r.in == left.end());
+    check(ranges::set_difference(left_list, right_list, expected.begin(), ranges::less{}, &elem::key, &elem::key)
+              .out,
+        difference_r.out);
+
+    assert(ranges::includes(left_list, right_list, ranges::less{}, &elem::key, &elem::key)
+           == ranges::includes(left, right, ranges::less{}, &elem::key, &elem::key));
+#endif // _HAS_CXX20
+}
+
+void test_random(mt19937& gen) {
+    for (int attempt = 0; attempt < 2000; ++attempt) {
+        const size_t left_size  = gen() % 200;
+        const size_t right_size = gen() % (attempt % 3 == 0 ? 200 : 10);
+        const int key_range     = static_cast<int>(gen() % 300) + 1;
+
+        vector<elem> left(left_size);
+        vector<elem> right(right_size);
+        int id = 0;
+        for (auto& e : left) {
+            e = {static_cast<int>(gen() % static_cast<unsigned int>(key_range)), id++};
+        }
+
+        for (auto& e : right) {
+            e = {static_cast<int>(gen() % static_cast<unsigned int>(key_range)), id++};
+        }
+
+        const auto by_key = [](const elem& lhs, const elem& rhs) { return lhs.key < rhs.key; };
+        stable_sort(left.begin(), left.end(), by_key);
+        stable_sort(right.begin(), right.end(), by_key);
+
+        test_case(left, right);
+        test_case(right, left);
+    }
+}
+
+void test_skewed() {
+    constexpr int big_size   = 1'000'000;
+    constexpr int small_size = 100;
+
+    vector<elem> big(big_size);
+    vector<elem> small(small_size);
+    for (int i = 0; i != big_size; ++i) {
+        big[static_cast<size_t>(i)] = {i, i};
+    }
+
+    for (int i = 0; i != small_size; ++i) {
+        small[static_cast<size_t>(i)] = {i * (big_size / small_size) + 7, big_size + i};
+    }
+
+    // Linear walks would take about big_size comparisons; allow a generous multiple of the logarithmic bound.
+    constexpr size_t max_count = small_size * 200;
+
+    size_t count = 0;
+    const counting_less pred{&count};
+
+    vector<elem> out(small_size);
+    assert(set_intersection(small.begin(), small.end(), big.begin(), big.end(), out.begin(), pred) == out.end());
+    assert(count < max_count);
+
+    count = 0;
+    assert(set_intersection(big.begin(), big.end(), small.begin(), small.end(), out.begin(), pred) == out.end());
+    assert(count < max_count);
+
+    count = 0;
+    assert(set_difference(small.begin(), small.end(), big.begin(), big.end(), out.begin(), pred) == out.begin());
+    assert(count < max_count);
+
+    count = 0;
+    assert(includes(big.begin(), big.end(), small.begin(), small.end(), pred));
+    assert(count < max_count);
+}
+
+// Alternating runs of run1 elements from left and run2 elements from right, optionally followed by a common element.
+void test_runs_case(const size_t run1, const size_t run2, const bool common) {
+    constexpr size_t total = 400;
+
+    vector<elem> left;
+    vector<elem> right;
+    int key = 0;
+    while (left.size() + right.size() < total) {
+        for (size_t i = 0; i != run1; ++i) {
+            left.push_back({key++, 0});
+        }
+
+        for (size_t i = 0; i != run2; ++i) {
+            right.push_back({key++, 1});
+        }
+
+        if (common) {
+            left.push_back({key, 0});
+            right.push_back({key++, 1});
+        }
+    }
+
+    // merge() may take N - 1 comparisons, includes() and the set operations 2 * N - 1.
+    const size_t merge_budget = left.size() + right.size() - 1;
+    const size_t set_budget   = 2 * (left.size() + right.size()) - 1;
+
+    size_t count = 0;
+    const counting_less pred{&count};
+
+    vector<elem> out(left.size() + right.size());
+
+    (void) merge(left.begin(), left.end(), right.begin(), right.end(), out.begin(), pred);
+    assert(count <= merge_budget);
+
+    count = 0;
+    (void) set_intersection(left.begin(), left.end(), right.begin(), right.end(), out.begin(), pred);
+    assert(count <= set_budget);
+
+    count = 0;
+    (void) set_difference(left.begin(), left.end(), right.begin(), right.end(), out.begin(), pred);
+    assert(count <= set_budget);
+
+    count = 0;
+    (void) includes(left.begin(), left.end(), right.begin(), right.end(), pred);
+    assert(count <= set_budget);
+
+#if _HAS_CXX20
+    count = 0;
+    (void) ranges::merge(left, right, out.begin(), pred);
+    assert(count <= merge_budget);
+
+    count = 0;
+    (void) ranges::set_intersection(left, right, out.begin(), pred);
+    assert(count <= set_budget);
+
+    count = 0;
+    (void) ranges::set_difference(left, right, out.begin(), pred);
+    assert(count <= set_budget);
+
+    count = 0;
+    (void) ranges::includes(left, right, pred);
+    assert(count <= set_budget);
+#endif // _HAS_CXX20
+}
+
+void test_runs() {
+    for (size_t run1 = 0; run1 != 20; ++run1) {
+        for (size_t run2 = 0; run2 != 20; ++run2) {
+            for (const bool common : {false, true}) {
+                if (run1 + run2 != 0 || common) {
+                    test_runs_case(run1, run2, common);
+                }
+            }
+        }
+    }
+
+    test_runs_case(100, 1, false);
+    test_runs_case(1, 100, false);
+    test_runs_case(100, 1, true);
+    test_runs_case(1, 100, true);
+}
+
+int main() {
+    mt19937 gen;
+    test_random(gen);
+    test_skewed();
+    test_runs();
+}
@@ -26,8 +26,11 @@
 #include <ranges>
 #endif // _HAS_CXX20
 
+#include "test_bounds_support.hpp"
+#include "test_is_heap_until_support.hpp"
 #include "test_is_sorted_until_support.hpp"
 #include "test_min_max_element_support.hpp"
+#include "test_sort_support.hpp"
 #include "test_vector_algorithms_support.hpp"
 
 using namespace std;
@@ -543,6 +546,40 @@ void test_search(mt19937_64& gen) {
     }
 }
 
+template <class T>
+void test_case_search_tail(const T* const hay_first, const T* const hay_last, const vector<T>& needle) {
+    const auto expected = last_known_good_search(hay_first, hay_last, needle.begin(), needle.end());
+    assert(search(hay_first, hay_last, needle.begin(), needle.end()) == expected);
+#if _HAS_CXX17
+    assert(search(hay_first, hay_last, boyer_moore_searcher{needle.begin(), needle.end()}) == expected);
+    assert(search(hay_first, hay_last, boyer_moore_horspool_searcher{needle.begin(), needle.end()}) == expected);
+#endif // _HAS_CXX17
+}
+
+template <class T>
+void test_search_tail() {
+    // The byte search checks candidate positions 32 at a time, then finishes the rest with a narrower path, which must
+    // not read past the haystack when there are no positions left. Put a copy of the needle so that it straddles the
+    // end of the haystack, so that reading past the end would report a false match.
+    vector<T> buffer;
+    vector<T> needle;
+    for (size_t needle_size = 17; needle_size <= 40; ++needle_size) {
+        needle.resize(needle_size);
+        for (size_t idx = 0; idx < needle_size; ++idx) {
+            needle[idx] = static_cast<T>('0' + idx % 10);
+        }
+
+        for (size_t hay_size = needle_size; hay_size <= needle_size + 100; ++hay_size) {
+            for (size_t overhang = 0; overhang < needle_size; ++overhang) {
+                // overhang == 0 puts the needle exactly at the end of the haystack, which must be found
+                buffer.assign(hay_size + needle_size, static_cast<T>('x'));
+                copy(needle.begin(), needle.end(), buffer.data() + (hay_size - needle_size + overhang));
+                test_case_search_tail(buffer.data(), buffer.data() + hay_size, needle);
+            }
+        }
+    }
+}
+
 template <class T>
 void test_min_max_element(mt19937_64& gen) {
     using Limits = numeric_limits<T>;
@@ -649,6 +686,150 @@ void test_is_sorted_until(mt19937_64& gen) {
     }
 }
 
+template <class T>
+void test_is_heap_until(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+
+    uniform_int_distribution<conditional_t<sizeof(T) == 1, int, T>> dis(Limits::min(), Limits::max());
+    uniform_int_distribution<int> dup_dis(0, 3);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    test_case_is_heap_until(input, less<>{});
+    test_case_is_heap_until(input, greater<>{});
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        // Occasionally repeat the previous element, to get equal parents and children
+        if (!input.empty() && dup_dis(gen) == 0) {
+            input.push_back(input.back());
+        } else {
+            input.push_back(static_cast<T>(dis(gen)));
+        }
+
+        uniform_int_distribution<ptrdiff_t> pos_dis{0, static_cast<ptrdiff_t>(input.size())};
+        const auto heap_size = pos_dis(gen);
+
+        test_is_heap_until_with_prefix_heap(input, heap_size, less<>{});
+        test_is_heap_until_with_prefix_heap(input, heap_size, greater<>{});
+    }
+}
+
+template <class T>
+void test_sort(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+
+    uniform_int_distribution<conditional_t<sizeof(T) == 1, int, T>> dis(Limits::min(), Limits::max());
+    uniform_int_distribution<int> dup_dis(0, 7);
+
+    vector<T> input;
+    vector<T> dup_input;
+    input.reserve(dataCount);
+    dup_input.reserve(dataCount);
+
+    test_case_sort(input, less<>{});
+    test_case_sort(input, greater<>{});
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        dup_input.push_back(static_cast<T>(dup_dis(gen)));
+
+        test_case_sort(input, less<>{});
+        test_case_sort(input, greater<>{});
+        test_case_sort(dup_input, less<>{});
+        test_case_sort(dup_input, greater<>{});
+    }
+
+    // sorted, reverse sorted, and organ pipe inputs are classic quicksort worst cases
+    vector<T> sorted_input = input;
+    sort(sorted_input.begin(), sorted_input.end());
+    test_case_sort(sorted_input, less<>{});
+    test_case_sort(sorted_input, greater<>{});
+
+    const auto half = sorted_input.begin() + static_cast<ptrdiff_t>(sorted_input.size() / 2);
+    reverse(half, sorted_input.end());
+    test_case_sort(sorted_input, less<>{});
+    test_case_sort(sorted_input, greater<>{});
+
+    test_case_sort(vector<T>(dataCount, Limits::min()), less<>{});
+    test_case_sort(vector<T>(dataCount, Limits::max()), greater<>{});
+
+    // long enough for counting sort of small element types, with both spread out and clustered values
+    vector<T> long_input(dataCount * 8);
+    generate(long_input.begin(), long_input.end(), [&] { return static_cast<T>(dis(gen)); });
+    test_case_sort(long_input, less<>{});
+    test_case_sort(long_input, greater<>{});
+
+    uniform_int_distribution<int> cluster_dis(-300, 300);
+    generate(long_input.begin(), long_input.end(), [&] { return static_cast<T>(cluster_dis(gen)); });
+    test_case_sort(long_input, less<>{});
+    test_case_sort(long_input, greater<>{});
+}
+
+template <class T>
+void test_nth_element(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+
+    uniform_int_distribution<conditional_t<sizeof(T) == 1, int, T>> dis(Limits::min(), Limits::max());
+    uniform_int_distribution<int> dup_dis(0, 7);
+
+    vector<T> input;
+    vector<T> dup_input;
+    input.reserve(dataCount);
+    dup_input.reserve(dataCount);
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        dup_input.push_back(static_cast<T>(dup_dis(gen)));
+
+        uniform_int_distribution<size_t> nth_dis(0, input.size() - 1);
+        const size_t nth = nth_dis(gen);
+        test_case_nth_element(input, nth, less<>{});
+        test_case_nth_element(input, nth, greater<>{});
+        test_case_nth_element(dup_input, nth, less<>{});
+        test_case_nth_element(dup_input, nth, greater<>{});
+    }
+
+    // sorted, reverse sorted, and organ pipe inputs are classic quickselect worst cases
+    vector<T> sorted_input = input;
+    sort(sorted_input.begin(), sorted_input.end());
+    test_case_nth_element(sorted_input, sorted_input.size() / 2, less<>{});
+    test_case_nth_element(sorted_input, sorted_input.size() / 3, greater<>{});
+
+    const auto half = sorted_input.begin() + static_cast<ptrdiff_t>(sorted_input.size() / 2);
+    reverse(half, sorted_input.end());
+    test_case_nth_element(sorted_input, sorted_input.size() / 2, less<>{});
+    test_case_nth_element(sorted_input, sorted_input.size() - 1, greater<>{});
+}
+
+template <class T>
+void test_bounds(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+
+    uniform_int_distribution<conditional_t<sizeof(T) == 1, int, T>> dis(Limits::min(), Limits::max());
+    uniform_int_distribution<int> dup_dis(-20, 20);
+
+    vector<T> input;
+    vector<T> dup_input;
+    input.reserve(dataCount);
+    dup_input.reserve(dataCount);
+
+    test_case_bounds(input, T{0});
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        const T val = static_cast<T>(dis(gen));
+        input.insert(upper_bound(input.begin(), input.end(), val), val);
+        const T dup_val = static_cast<T>(dup_dis(gen));
+        dup_input.insert(upper_bound(dup_input.begin(), dup_input.end(), dup_val), dup_val);
+
+        test_case_bounds(input, static_cast<T>(dis(gen)));
+        test_case_bounds(input, input[static_cast<size_t>(dup_dis(gen) + 20) % input.size()]);
+        test_case_bounds(input, Limits::min());
+        test_case_bounds(input, Limits::max());
+        test_case_bounds(dup_input, static_cast<T>(dup_dis(gen)));
+    }
+}
+
 #if _HAS_CXX17
 template <class InIt1, class InIt2>
 bool last_known_good_includes(InIt1 first1, InIt1 last1, InIt2 first2, InIt2 last2) {
@@ -714,6 +895,176 @@ void test_includes(mt19937_64& gen) {
 }
 #endif // _HAS_CXX17
 
+template <class InIt1, class InIt2, class OutIt>
+OutIt last_known_good_merge(InIt1 first1, InIt1 last1, InIt2 first2, InIt2 last2, OutIt dest) {
+    for (; first1 != last1 && first2 != last2; ++dest) {
+        if (*first2 < *first1) {
+            *dest = *first2;
+            ++first2;
+        } else {
+            *dest = *first1;
+            ++first1;
+        }
+    }
+
+    dest = copy(first1, last1, dest);
+    return copy(first2, last2, dest);
+}
+
+template <class InIt1, class InIt2, class OutIt>
+OutIt last_known_good_set_union(InIt1 first1, InIt1 last1, InIt2 first2, InIt2 last2, OutIt dest) {
+    for (; first1 != last1 && first2 != last2; ++dest) {
+        if (*first1 < *first2) {
+            *dest = *first1;
+            ++first1;
+        } else if (*first2 < *first1) {
+            *dest = *first2;
+            ++first2;
+        } else {
+            *dest = *first1;
+            ++first1;
+            ++first2;
+        }
+    }
+
+    dest = copy(first1, last1, dest);
+    return copy(first2, last2, dest);
+}
+
+template <class InIt1, class InIt2, class OutIt>
+OutIt last_known_good_set_intersection(InIt1 first1, InIt1 last1, InIt2 first2, InIt2 last2, OutIt dest) {
+    while (first1 != last1 && first2 != last2) {
+        if (*first1 < *first2) {
+            ++first1;
+        } else if (*first2 < *first1) {
+            ++first2;
+        } else {
+            *dest = *first1;
+            ++dest;
+            ++first1;
+            ++first2;
+        }
+    }
+
+    return dest;
+}
+
+template <class InIt1, class InIt2, class OutIt>
+OutIt last_known_good_set_difference(InIt1 first1, InIt1 last1, InIt2 first2, InIt2 last2, OutIt dest) {
+    while (first1 != last1 && first2 != last2) {
+        if (*first1 < *first2) {
+            *dest = *first1;
+            ++dest;
+            ++first1;
+        } else {
+            if (!(*first2 < *first1)) {
+                ++first1;
+            }
+
+            ++first2;
+        }
+    }
+
+    return copy(first1, last1, dest);
+}
+
+template <class T>
+void test_case_set_operations(const vector<T>& left, const vector<T>& right) {
+    vector<T> expected(left.size() + right.size());
+    vector<T> actual(left.size() + right.size());
+
+    const auto check = [&](const auto expected_last, const auto actual_last) {
+        assert(expected_last - expected.begin() == actual_last - actual.begin());
+        assert(equal(expected.begin(), expected_last, actual.begin(), actual_last));
+    };
+
+    check(last_known_good_merge(left.begin(), left.end(), right.begin(), right.end(), expected.begin()),
+        merge(left.begin(), left.end(), right.begin(), right.end(), actual.begin()));
+    check(last_known_good_set_union(left.begin(), left.end(), right.begin(), right.end(), expected.begin()),
+        set_union(left.begin(), left.end(), right.begin(), right.end(), actual.begin()));
+    check(last_known_good_set_intersection(left.begin(), left.end(), right.begin(), right.end(), expected.begin()),
+        set_intersection(left.begin(), left.end(), right.begin(), right.end(), actual.begin()));
+    check(last_known_good_set_difference(left.begin(), left.end(), right.begin(), right.end(), expected.begin()),
+        set_difference(left.begin(), left.end(), right.begin(), right.end(), actual.begin()));
+#if _HAS_CXX20
+    const auto merge_expected =
+        last_known_good_merge(left.begin(), left.end(), right.begin(), right.end(), expected.begin());
+    const auto merge_r = ranges::merge(left, right, actual.begin());
+    assert(merge_r.in1 == left.end());
+    assert(merge_r.in2 == right.end());
+    check(merge_expected, merge_r.out);
+
+    const auto union_expected =
+        last_known_good_set_union(left.begin(), left.end(), right.begin(), right.end(), expected.begin());
+    const auto union_r = ranges::set_union(left, right, actual.begin());
+    assert(union_r.in1 == left.end());
+    assert(union_r.in2 == right.end());
+    check(union_expected, union_r.out);
+
+    const auto intersection_expected =
+        last_known_good_set_intersection(left.begin(), left.end(), right.begin(), right.end(), expected.begin());
+    const auto intersection_r = ranges::set_intersection(left, right, actual.begin());
+    assert(intersection_r.in1 == left.end());
+    assert(intersection_r.in2 == right.end());
+    check(intersection_expected, intersection_r.out);
+
+    const auto difference_expected =
+        last_known_good_set_difference(left.begin(), left.end(), right.begin(), right.end(), expected.begin());
+    const auto difference_r = ranges::set_difference(left, right, actual.begin());
+    assert(difference_r.in == left.end());
+    check(difference_expected, difference_r.out);
+#endif // _HAS_CXX20
+}
+
+template <class T>
+void test_set_operations(mt19937_64& gen) {
+    using Limits = numeric_limits<T>;
+
+    uniform_int_distribution<T> dis(Limits::min(), Limits::max());
+    uniform_int_distribution<int> dup_dis(0, 40);
+    uniform_int_distribution<int> coin_dis(0, 3);
+
+    vector<T> left;
+    vector<T> right;
+    vector<T> dup_left;
+    vector<T> dup_right;
+    left.reserve(dataCount);
+    right.reserve(dataCount);
+    dup_left.reserve(dataCount);
+    dup_right.reserve(dataCount);
+
+    test_case_set_operations(left, right);
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        // Shared values make the ranges overlap, so that all the operations have work to do
+        const T val = static_cast<T>(dis(gen));
+        switch (coin_dis(gen)) {
+        case 0:
+            left.insert(upper_bound(left.begin(), left.end(), val), val);
+            break;
+        case 1:
+            right.insert(upper_bound(right.begin(), right.end(), val), val);
+            break;
+        default:
+            left.insert(upper_bound(left.begin(), left.end(), val), val);
+            right.insert(upper_bound(right.begin(), right.end(), val), val);
+            break;
+        }
+
+        const T dup_val = static_cast<T>(dup_dis(gen));
+        if (coin_dis(gen) < 2) {
+            dup_left.insert(upper_bound(dup_left.begin(), dup_left.end(), dup_val), dup_val);
+        } else {
+            dup_right.insert(upper_bound(dup_right.begin(), dup_right.end(), dup_val), dup_val);
+        }
+
+        test_case_set_operations(left, right);
+        test_case_set_operations(right, left);
+        test_case_set_operations(dup_left, dup_right);
+        test_case_set_operations(dup_right, dup_left);
+    }
+}
+
 template <class FwdIt, class T>
 void last_known_good_replace(FwdIt first, FwdIt last, const T old_val, const T new_val) {
     for (; first != last; ++first) {
@@ -1241,6 +1592,10 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_search<long long>(gen);
     test_search<unsigned long long>(gen);
 
+    test_search_tail<char>();
+    test_search_tail<signed char>();
+    test_search_tail<unsigned char>();
+
     test_min_max_element<char>(gen);
     test_min_max_element<signed char>(gen);
     test_min_max_element<unsigned char>(gen);
@@ -1274,6 +1629,49 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_is_sorted_until<long long>(gen);
     test_is_sorted_until<unsigned long long>(gen);
 
+    test_is_heap_until<char>(gen);
+    test_is_heap_until<signed char>(gen);
+    test_is_heap_until<unsigned char>(gen);
+    test_is_heap_until<short>(gen);
+    test_is_heap_until<unsigned short>(gen);
+    test_is_heap_until<int>(gen);
+    test_is_heap_until<unsigned int>(gen);
+    test_is_heap_until<long long>(gen);
+    test_is_heap_until<unsigned long long>(gen);
+
+    test_sort<char>(gen);
+    test_sort<signed char>(gen);
+    test_sort<unsigned char>(gen);
+#ifdef __cpp_char8_t
+    test_sort<char8_t>(gen);
+#endif // __cpp_char8_t
+    test_sort<short>(gen);
+    test_sort<unsigned short>(gen);
+    test_sort<int>(gen);
+    test_sort<unsigned int>(gen);
+    test_sort<long long>(gen);
+    test_sort<unsigned long long>(gen);
+
+    test_nth_element<char>(gen);
+    test_nth_element<signed char>(gen);
+    test_nth_element<unsigned char>(gen);
+    test_nth_element<short>(gen);
+    test_nth_element<unsigned short>(gen);
+    test_nth_element<int>(gen);
+    test_nth_element<unsigned int>(gen);
+    test_nth_element<long long>(gen);
+    test_nth_element<unsigned long long>(gen);
+
+    test_bounds<char>(gen);
+    test_bounds<signed char>(gen);
+    test_bounds<unsigned char>(gen);
+    test_bounds<short>(gen);
+    test_bounds<unsigned short>(gen);
+    test_bounds<int>(gen);
+    test_bounds<unsigned int>(gen);
+    test_bounds<long long>(gen);
+    test_bounds<unsigned long long>(gen);
+
     // std::includes has been there forever, but we use std::sample in the test, and that one is C++17
 #if _HAS_CXX17
     test_includes<char>(gen);
@@ -1287,6 +1685,12 @@ void test_vector_algorithms(mt19937_64& gen) {
     test_includes<unsigned long long>(gen);
 #endif // _HAS_CXX17
 
+    // merge(), set_union(), set_intersection(), and set_difference() are vectorized for 4 and 8 bytes only.
+    test_set_operations<int>(gen);
+    test_set_operations<unsigned int>(gen);
+    test_set_operations<long long>(gen);
+    test_set_operations<unsigned long long>(gen);
+
     // replace() is vectorized for 4 and 8 bytes only.
     test_replace<int>(gen);
     test_replace<unsigned int>(gen);
@@ -8,8 +8,11 @@
 #include <random>
 #include <vector>
 
+#include "test_bounds_support.hpp"
+#include "test_is_heap_until_support.hpp"
 #include "test_is_sorted_until_support.hpp"
 #include "test_min_max_element_support.hpp"
+#include "test_sort_support.hpp"
 #include "test_vector_algorithms_support.hpp"
 
 using namespace std;
@@ -124,12 +127,96 @@ void test_is_sorted_until_floating_with_values(mt19937_64& gen, const vector<T>&
     }
 }
 
+template <class T>
+void test_is_heap_until_floating_with_values(mt19937_64& gen, const vector<T>& input_of_input) {
+    uniform_int_distribution<size_t> idx_dis(0, input_of_input.size() - 1);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    test_case_is_heap_until(input, less<>{});
+    test_case_is_heap_until(input, greater<>{});
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(input_of_input[idx_dis(gen)]);
+
+        uniform_int_distribution<ptrdiff_t> pos_dis{0, static_cast<ptrdiff_t>(input.size())};
+        const auto heap_size = pos_dis(gen);
+
+        test_is_heap_until_with_prefix_heap(input, heap_size, less<>{});
+        test_is_heap_until_with_prefix_heap(input, heap_size, greater<>{});
+    }
+}
+
+template <class T>
+void test_sort_floating_with_values(mt19937_64& gen, const vector<T>& input_of_input) {
+    uniform_int_distribution<size_t> idx_dis(0, input_of_input.size() - 1);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    test_case_sort(input, less<>{});
+    test_case_sort(input, greater<>{});
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(input_of_input[idx_dis(gen)]);
+
+        test_case_sort(input, less<>{});
+        test_case_sort(input, greater<>{});
+    }
+}
+
+template <class T>
+void test_nth_element_floating_with_values(mt19937_64& gen, const vector<T>& input_of_input) {
+    uniform_int_distribution<size_t> idx_dis(0, input_of_input.size() - 1);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(input_of_input[idx_dis(gen)]);
+
+        uniform_int_distribution<size_t> nth_dis(0, input.size() - 1);
+        const size_t nth = nth_dis(gen);
+        test_case_nth_element(input, nth, less<>{});
+        test_case_nth_element(input, nth, greater<>{});
+    }
+}
+
+template <class T>
+void test_bounds_floating_with_values(mt19937_64& gen, const vector<T>& input_of_input) {
+    uniform_int_distribution<size_t> idx_dis(0, input_of_input.size() - 1);
+
+    vector<T> input;
+    input.reserve(dataCount);
+
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        const T val = input_of_input[idx_dis(gen)];
+        input.insert(upper_bound(input.begin(), input.end(), val), val);
+
+        test_case_bounds(input, input_of_input[idx_dis(gen)]);
+        test_case_bounds(input, -val);
+    }
+}
+
 void test_vector_algorithms(mt19937_64& gen) {
     test_min_max_element_floating<float>(gen);
     test_min_max_element_floating<double>(gen);
 
     test_is_sorted_until_floating_with_values(gen, test_floating_input<float>(gen));
     test_is_sorted_until_floating_with_values(gen, test_floating_input<double>(gen));
+
+    test_is_heap_until_floating_with_values(gen, test_floating_input<float>(gen));
+    test_is_heap_until_floating_with_values(gen, test_floating_input<double>(gen));
+
+    test_sort_floating_with_values(gen, test_floating_input<float>(gen));
+    test_sort_floating_with_values(gen, test_floating_input<double>(gen));
+
+    test_nth_element_floating_with_values(gen, test_floating_input<float>(gen));
+    test_nth_element_floating_with_values(gen, test_floating_input<double>(gen));
+
+    test_bounds_floating_with_values(gen, test_floating_input<float>(gen));
+    test_bounds_floating_with_values(gen, test_floating_input<double>(gen));
 }
 
 int main() {
@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// The work-stealing pool in stl/src isn't part of the default build, so exercise it directly. Cancellation is only
+// observable for submissions which haven't started, so the cancellation tests first occupy every worker.
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <thread>
+
+#include "../../../../stl/src/work_stealing_pool.hpp"
+
+using namespace std;
+
+struct counting_work : _Pool_work {
+    counting_work() noexcept : _Pool_work(&invoke) {}
+
+    static void invoke(_Pool_work& work) noexcept {
+        auto& self = static_cast<counting_work&>(work);
+        if (self.caller != thread::id{} && this_thread::get_id() != self.caller) {
+            self.off_caller.fetch_add(1);
+        }
+
+        self.count.fetch_add(1);
+    }
+
+    atomic<size_t> count{0};
+    atomic<size_t> off_caller{0};
+    thread::id caller{};
+};
+
+struct blocking_work : _Pool_work {
+    blocking_work() noexcept : _Pool_work(&invoke) {}
+
+    static void invoke(_Pool_work& work) noexcept {
+        auto& self = static_cast<blocking_work&>(work);
+        self.started.fetch_add(1);
+        while (!self.released.load()) {
+            this_thread::yield();
+        }
+    }
+
+    atomic<size_t> started{0};
+    atomic<bool> released{false};
+};
+
+constexpr size_t submissions = 100;
+
+void test_no_workers() {
+    _Work_stealing_pool pool{0};
+
+    // callbacks run on the waiting thread, and only once it waits
+    counting_work work;
+    work.caller = this_thread::get_id();
+    pool._Submit(work, submissions);
+    assert(work.count.load() == 0);
+    pool._Wait(work, false);
+    assert(work.count.load() == submissions);
+    assert(work.off_caller.load() == 0);
+
+    // nothing has started, so canceling drops every submission
+    work.count.store(0);
+    pool._Submit(work, submissions);
+    pool._Wait(work, true);
+    assert(work.count.load() == 0);
+
+    // a canceled work can be submitted again
+    pool._Submit(work, submissions);
+    pool._Wait(work, false);
+    assert(work.count.load() == submissions);
+
+    // submitting nothing and waiting with nothing outstanding are no-ops
+    pool._Submit(work, 0);
+    pool._Wait(work, false);
+    pool._Wait(work, true);
+    assert(work.count.load() == submissions);
+}
+
+void test_workers(const size_t workers) {
+    _Work_stealing_pool pool{workers};
+
+    counting_work work;
+    pool._Submit(work, submissions);
+    pool._Wait(work, false);
+    assert(work.count.load() == submissions);
+
+    // several works can be outstanding at once
+    counting_work first;
+    counting_work second;
+    for (size_t idx = 0; idx < 10; ++idx) {
+        pool._Submit(first, submissions);
+        pool._Submit(second, 1);
+    }
+
+    pool._Wait(second, false);
+    pool._Wait(first, false);
+    assert(first.count.load() == 10 * submissions);
+    assert(second.count.load() == 10);
+
+    // occupy every worker, so the counting work's submissions stay queued until canceled
+    blocking_work blocker;
+    pool._Submit(blocker, workers);
+    while (blocker.started.load() != workers) {
+        this_thread::yield();
+    }
+
+    work.count.store(0);
+    pool._Submit(work, submissions);
+    pool._Wait(work, true);
+    assert(work.count.load() == 0);
+
+    blocker.released.store(true);
+    pool._Wait(blocker, false);
+    assert(blocker.started.load() == workers);
+
+    // a canceled work can be submitted again
+    pool._Submit(work, submissions);
+    pool._Wait(work, false);
+    assert(work.count.load() == submissions);
+}
+
+int main() {
+    test_no_workers();
+    test_workers(1);
+    test_workers(4);
+}